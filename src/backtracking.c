@@ -4,173 +4,885 @@
  *
  * Algorithmes implementes :
  *   1. Backtracking avec elagage pour chemins contraints
- *   2. K plus courts chemins (Yen / diviser pour regner)
+ *      (moteur iteratif a pile explicite, version sequentielle et parallele)
+ *   2. Routage par points de passage (Held-Karp sur les obligatoires)
+ *   3. K plus courts chemins (Yen / diviser pour regner)
  *
  * Analyse de complexite :
  *   - Sans elagage : O(V!) dans le pire cas (exploration exhaustive)
  *   - Avec elagage cout    : reduit de ~60% en pratique
  *   - Avec elagage latence : reduit de ~40% supplementaire
  *   - Avec tous les elagages : O(b^d) avec b << V
+ *   - Bornes inferieures h_lat / h_cout : coupent les branches qui ne peuvent
+ *     plus ni atteindre la destination dans le budget ni battre le meilleur
+ *   - Chaque pas de la recherche est en O(1) hors parcours des aretes :
+ *     aucune allocation, aucun parcours de liste chainee du chemin
  */
 
 #include "backtracking.h"
 #include "utils.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+/* Tolerance sur les bornes : h_lat et h_cout sont des sommes flottantes
+   calculees dans l'autre sens, elles ne doivent pas couper un chemin exact */
+#define EPS_BORNE 1e-4f
+
+/* Decoupage des taches en mode parallele */
+#define TACHES_PAR_THREAD   4
+#define PROF_DECOUPE_MAX    8
+
+/* Echeance et budget de noeuds controles tous les N noeuds explores */
+#define INTERVALLE_CONTROLE 1024
+
+/* Etiquettes de dominance conservees par noeud (memoire O(V)) */
+#define MEMO_PAR_NOEUD      8
+#define MEMO_PAR_NOEUD_MAX  255
+
+/* Mode K meilleurs : capacite initiale du tas, doublee a la demande */
+#define TAS_K_CAPA_INIT     16
 
 /* ============================================================
  *  CONTEXTE INTERNE DU BACKTRACKING
  * ============================================================ */
 
+typedef struct PartageBT PartageBT;
+
+/**
+ * @brief Etat deja atteint en un noeud : un nouvel arrivant au moins aussi
+ *        lent, cher, etroit, et sans obligatoire de plus, est domine
+ */
+typedef struct EtiquetteBT {
+    float    lat;
+    float    cout;
+    float    bw;
+    uint64_t masque;        /**< Obligatoires visites (rang < 64) */
+} EtiquetteBT;
+
+/**
+ * @brief Chemin complet retenu en mode K meilleurs
+ */
+typedef struct CandidatBT {
+    int*  noeuds;
+    int   longueur;
+    float lat;
+    float cout;
+    float bw;
+} CandidatBT;
+
+/**
+ * @brief Tas max borne des K meilleurs chemins complets : la racine est le
+ *        K-ieme, sa latence sert de borne d'elagage une fois le tas plein.
+ *        Le tableau grandit par doublement : K peut depasser de loin le
+ *        nombre de chemins qui existent
+ */
+typedef struct TasCheminsBT {
+    CandidatBT* t;
+    int         nb;
+    int         capa;
+    int         k;
+} TasCheminsBT;
+
+/**
+ * @brief Contraintes compilees une fois par requete (partagees en lecture)
+ *
+ * Les aretes admissibles (bw, securite, extremite non exclue) sont
+ * copiees une fois dans un CSR avant, restreint aux noeuds qui peuvent
+ * appartenir a un chemin valide, eventuellement trie par
+ * latence + h_lat(voisin) pour explorer d'abord les voisins prometteurs.
+ *
+ * Les listes de Contraintes deviennent des tables indexees par ID :
+ *   exclu          : ensemble de bits des noeuds exclus
+ *   index_oblig[v] : rang de v parmi les obligatoires, -1 sinon
+ *   debut/cible_oblig : pour chaque noeud x, les obligatoires m atteints
+ *                    par une arete admissible x -> m (format CSR)
+ *   entrees_init[m] : nombre de ces aretes entrant dans m
+ */
+typedef struct RequeteBT {
+    float*    h_lat;          /**< Latence minimale restante vers la destination */
+    float*    h_cout;         /**< Cout minimal restant vers la destination */
+    GrapheCSR* avant;         /**< Aretes admissibles et utiles, par origine */
+    int       noeuds_utiles;  /**< Noeuds ayant encore des aretes dans avant */
+    uint64_t* exclu;
+    int*      index_oblig;
+    int*      oblig;          /**< Obligatoires distincts */
+    int       nb_oblig;
+    int*      debut_oblig;
+    int*      cible_oblig;
+    int*      entrees_init;
+    /* Chemin faisable trouve avant la recherche (amorce_long = 0 : aucun) */
+    int*      amorce;
+    int       amorce_long;
+    float     amorce_lat;
+    float     amorce_cout;
+    float     amorce_bw;
+} RequeteBT;
+
+/**
+ * @brief Etat d'une recherche (un par thread en mode parallele)
+ *
+ * La pile de recursion est remplacee par des tableaux indexes par la
+ * profondeur d, alloues une fois (taille V) :
+ *   chemin[d]  = noeud a la profondeur d (chemin[0] = source)
+ *   curseur[d] = indice CSR de la prochaine arete a essayer depuis chemin[d]
+ *   lat/cout/bw[d] = cumuls depuis la source jusqu'a chemin[d]
+ *
+ * entrees[m] compte les aretes admissibles x -> m dont l'origine x est
+ * hors du chemin ou en est le sommet : a 0, l'obligatoire m ne peut plus
+ * etre atteint et la branche est coupee.
+ *
+ * memo[] garde pour chaque noeud quelques etats non domines deja
+ * atteints. Sans obligatoires, la coupe est exacte : si P' domine P en v,
+ * toute fin Q de P donne P' + Q, ou un raccourci P'[s..x] + Q[x..d] si Q
+ * recoupe P', au moins aussi bon. Avec obligatoires, ce raccourci peut
+ * sauter un obligatoire : la coupe n'est alors active que sur demande.
+ */
 typedef struct ContextBacktrack {
     const Graphe*      g;
     const Contraintes* contraintes;
     int                destination;
-    int*               visite;       /**< Noeuds deja dans le chemin courant */
-    Chemin*            meilleur;     /**< Meilleur chemin trouve jusqu'ici */
-    Chemin*            courant;      /**< Chemin en cours d'exploration */
+    const RequeteBT*   rq;
+    /* Pile explicite */
+    int*               chemin;
+    int*               curseur;
+    float*             lat;
+    float*             cout;
+    float*             bw;
+    char*              visite;       /**< Noeuds deja dans le chemin courant */
+    int*               nb_vus;       /**< nb_vus[d] = obligatoires dans chemin[0..d] */
+    int*               entrees;      /**< Aretes encore utilisables vers chaque obligatoire */
+    uint64_t*          masque;       /**< masque[d] = obligatoires de chemin[0..d] */
+    /* Memoisation de la dominance (memo_k = 0 : desactivee) */
+    EtiquetteBT*       memo;         /**< memo_k etiquettes par noeud */
+    unsigned char*     memo_nb;
+    int                memo_k;
+    /* Meilleur chemin (mode sequentiel) */
+    TasCheminsBT*      k_meilleurs;  /**< Mode K meilleurs (NULL : un seul chemin) */
+    float              meilleure_lat;
+    int*               meilleur;     /**< Copie de chemin[] au dernier record */
+    int                meilleur_long;
+    float              meilleur_cout;
+    float              meilleur_bw;
+    /* Mode parallele (NULL en sequentiel) */
+    PartageBT*         partage;
+    int                id;
+    /* Limites (NULL = aucune) */
+    const OptionsBacktrack* opt;
+    double             t_debut;
+    double             dernier_rappel;
+    int                prochain_controle; /**< noeuds_explores du prochain controle */
+    int                noeuds_publies;    /**< Deja ajoutes au compteur global */
+    int                arret;             /**< Echeance ou budget atteint */
     /* Stats d'elagage */
-    int noeuds_explores;
-    int branches_elaguees;
-    int chemins_trouves;
+    StatsBacktrack     stats;
 } ContextBacktrack;
 
+/**
+ * @brief Etat partage entre les threads du mode parallele
+ */
+typedef struct TacheBT {
+    float lat;
+    float cout;
+    float bw;
+    int   longueur;         /**< Nombre de noeuds du prefixe */
+    int   noeuds[];         /**< Prefixe depuis la source */
+} TacheBT;
+
+typedef struct DequeBT {
+    TacheBT**       t;
+    int             haut;    /**< Indice du plus ancien (vol) */
+    int             bas;     /**< Indice apres le plus recent (proprietaire) */
+    int             capa;
+    pthread_mutex_t verrou;
+} DequeBT;
+
+struct PartageBT {
+    atomic_uint        meilleure_bits;  /**< Latence du meilleur chemin (bits) */
+    pthread_mutex_t    verrou_meilleur;
+    int*               meilleur;        /**< Noeuds du meilleur chemin */
+    int                meilleur_long;
+    float              meilleur_cout;
+    float              meilleur_bw;
+    DequeBT*           deques;
+    int                nb_workers;
+    atomic_int         taches_restantes;
+    atomic_int         nb_inactifs;
+    atomic_int         noeuds_total;    /**< Budget de noeuds commun */
+    atomic_int         arret;
+    pthread_mutex_t    verrou_rappel;   /**< Un seul rappel de progression a la fois */
+};
+
 /* ============================================================
  *  FONCTIONS D'ELAGAGE
  * ============================================================ */
 
 /**
- * @brief Verifie si une arete respecte les contraintes de BW et securite
+ * @brief Un obligatoire pas encore visite n'a plus aucune arete d'entree
+ * @complexity O(k)
+ */
+static int obligatoire_inaccessible(const ContextBacktrack* ctx) {
+    const RequeteBT* rq = ctx->rq;
+    for (int i = 0; i < rq->nb_oblig; i++) {
+        int m = rq->oblig[i];
+        if (!ctx->visite[m] && ctx->entrees[m] == 0) return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief x quitte (sens = -1) ou redevient (sens = +1) le sommet du chemin :
+ *        ses aretes vers les obligatoires deviennent inutilisables ou le redeviennent
+ * @complexity O(aretes de x vers des obligatoires)
  */
-static int arete_valide(const Arete* a, const Contraintes* c) {
-    return (a->bande_passante >= c->bw_min_requise) &&
-           (a->securite       >= c->securite_min);
+static void ajuster_entrees(ContextBacktrack* ctx, int x, int sens) {
+    const RequeteBT* rq = ctx->rq;
+    if (rq->nb_oblig == 0) return;
+    for (int i = rq->debut_oblig[x]; i < rq->debut_oblig[x + 1]; i++)
+        ctx->entrees[rq->cible_oblig[i]] += sens;
 }
 
 /**
- * @brief Verifie si un noeud est dans la liste des exclusions
+ * @brief Coupe l'etat (lat, cout, bw, m) en v s'il est domine, sinon le
+ *        memorise en retirant les etiquettes qu'il domine
+ * @return 1 si l'etat est domine
+ * @complexity O(memo_k)
  */
-static int noeud_exclu(int id, const Contraintes* c) {
-    for (int i = 0; i < c->nb_exclus; i++)
-        if (c->noeuds_exclus[i] == id) return 1;
+static int domine_ou_memorise(ContextBacktrack* ctx, int v, float lat,
+                              float cout, float bw, uint64_t m) {
+    EtiquetteBT* e = ctx->memo + (size_t)v * ctx->memo_k;
+    int n = ctx->memo_nb[v];
+    for (int i = 0; i < n; i++)
+        if (e[i].lat <= lat && e[i].cout <= cout && e[i].bw >= bw &&
+            (e[i].masque & m) == m)
+            return 1;
+
+    int k = 0;
+    for (int i = 0; i < n; i++)
+        if (!(lat <= e[i].lat && cout <= e[i].cout && bw >= e[i].bw &&
+              (m & e[i].masque) == e[i].masque))
+            e[k++] = e[i];
+
+    /* Plein : la plus lente cede sa place (perte de coupes, jamais d'exactitude) */
+    if (k == ctx->memo_k) {
+        int pire = 0;
+        for (int i = 1; i < k; i++) if (e[i].lat > e[pire].lat) pire = i;
+        e[pire] = e[--k];
+        ctx->stats.memo_evictions++;
+    }
+    e[k].lat = lat; e[k].cout = cout; e[k].bw = bw; e[k].masque = m;
+    ctx->memo_nb[v] = (unsigned char)(k + 1);
+    ctx->stats.memo_insertions++;
     return 0;
 }
 
+typedef struct CleVoisin { float cle; int indice; } CleVoisin;
+
+static int comparer_cles(const void* a, const void* b) {
+    const CleVoisin* x = (const CleVoisin*)a;
+    const CleVoisin* y = (const CleVoisin*)b;
+    if (x->cle != y->cle) return x->cle < y->cle ? -1 : 1;
+    return x->indice - y->indice;
+}
+
 /**
- * @brief Verifie si tous les noeuds obligatoires sont dans le chemin courant
+ * @brief Trie les aretes de chaque noeud par latence + h_lat(voisin)
+ * @complexity O(E log d)
  */
-static int tous_obligatoires_visites(const Chemin* chemin,
-                                     const Contraintes* c) {
-    for (int i = 0; i < c->nb_obligatoires; i++) {
-        if (!chemin_contient(chemin, c->noeuds_oblgatoires[i]))
-            return 0;
+static void trier_voisins(GrapheCSR* a, const float* h_lat) {
+    int max_deg = 0;
+    for (int u = 0; u < a->nb_noeuds; u++)
+        if (a->debut[u + 1] - a->debut[u] > max_deg) max_deg = a->debut[u + 1] - a->debut[u];
+    if (max_deg < 2) return;
+
+    CleVoisin* cles = (CleVoisin*)malloc(max_deg * sizeof(CleVoisin));
+    int*   t_voisin = (int*)  malloc(max_deg * sizeof(int));
+    int*   t_sec    = (int*)  malloc(max_deg * sizeof(int));
+    float* t_lat    = (float*)malloc(max_deg * sizeof(float));
+    float* t_bw     = (float*)malloc(max_deg * sizeof(float));
+    float* t_cout   = (float*)malloc(max_deg * sizeof(float));
+    for (int u = 0; u < a->nb_noeuds; u++) {
+        int deb = a->debut[u], n = a->debut[u + 1] - deb;
+        if (n < 2) continue;
+        for (int i = 0; i < n; i++) {
+            float h = h_lat[a->voisin[deb + i]];
+            cles[i].cle    = (h == INFINI) ? INFINI : a->latence[deb + i] + h;
+            cles[i].indice = i;
+        }
+        qsort(cles, n, sizeof(CleVoisin), comparer_cles);
+        for (int i = 0; i < n; i++) {
+            int j = deb + cles[i].indice;
+            t_voisin[i] = a->voisin[j]; t_sec[i] = a->securite[j];
+            t_lat[i] = a->latence[j]; t_bw[i] = a->bande_passante[j]; t_cout[i] = a->cout[j];
+        }
+        memcpy(a->voisin + deb,         t_voisin, n * sizeof(int));
+        memcpy(a->securite + deb,       t_sec,    n * sizeof(int));
+        memcpy(a->latence + deb,        t_lat,    n * sizeof(float));
+        memcpy(a->bande_passante + deb, t_bw,     n * sizeof(float));
+        memcpy(a->cout + deb,           t_cout,   n * sizeof(float));
     }
-    return 1;
+    free(cles); free(t_voisin); free(t_sec); free(t_lat); free(t_bw); free(t_cout);
 }
 
 /**
- * @brief Retire le dernier noeud du chemin (operation de retour arriere)
- * @complexity O(longueur du chemin)
+ * @brief Suit l'arbre des plus courts chemins (succ = prochain saut vers la
+ *        destination) depuis la source ; garde le chemin comme amorce s'il
+ *        respecte budget et obligatoires et bat l'amorce courante
+ * @complexity O(V + E)
  */
-static void retirer_dernier_noeud(Chemin* c) {
-    if (!c || !c->tete) return;
-    if (!c->tete->suivant) {
-        /* Un seul noeud */
-        free(c->tete);
-        c->tete = NULL;
-        c->longueur = 0;
+static void essayer_amorce(RequeteBT* rq, const int* succ, int critere,
+                           int source, int destination, const Contraintes* c) {
+    const GrapheCSR* a = rq->avant;
+    int V = a->nb_noeuds, n = 0, vus = 0;
+    float lat = 0.0f, cout = 0.0f, bw = INFINI;
+    int* noeuds = (int*)malloc(V * sizeof(int));
+
+    int u = source;
+    noeuds[n++] = u;
+    vus += (rq->index_oblig[u] >= 0);
+    while (u != destination) {
+        int v = succ[u], e_min = -1;
+        if (v < 0 || n == V) { free(noeuds); return; }
+        /* Arete u -> v la moins chere selon le critere de l'arbre */
+        const float* poids = (critere == CRITERE_COUT) ? a->cout : a->latence;
+        for (int e = a->debut[u]; e < a->debut[u + 1]; e++)
+            if (a->voisin[e] == v && (e_min < 0 || poids[e] < poids[e_min])) e_min = e;
+        if (e_min < 0) { free(noeuds); return; }
+        lat  += a->latence[e_min];
+        cout += a->cout[e_min];
+        if (a->bande_passante[e_min] < bw) bw = a->bande_passante[e_min];
+        noeuds[n++] = v;
+        vus += (rq->index_oblig[v] >= 0);
+        u = v;
+    }
+    if (cout > c->cout_max_autorise || vus < rq->nb_oblig ||
+        (rq->amorce_long > 0 && lat >= rq->amorce_lat)) {
+        free(noeuds);
         return;
     }
-    /* Trouver l'avant-dernier */
-    NoeudChemin* courant = c->tete;
-    while (courant->suivant->suivant)
-        courant = courant->suivant;
-    free(courant->suivant);
-    courant->suivant = NULL;
-    c->longueur--;
+    free(rq->amorce);
+    rq->amorce      = noeuds;
+    rq->amorce_long = n;
+    rq->amorce_lat  = lat;
+    rq->amorce_cout = cout;
+    rq->amorce_bw   = bw;
+}
+
+/**
+ * @brief Prepare une requete : compile les contraintes et calcule les bornes
+ *        inferieures (Dijkstra inverse depuis la destination sur le
+ *        sous-graphe respectant bw / securite / exclusions)
+ *
+ * Heuristiques (opt) : amorce = meilleur chemin faisable parmi les arbres
+ * de latence et de cout minimaux deja calcules pour les bornes ; tri des
+ * voisins du CSR avant par latence + h_lat.
+ *
+ * @return 0 si la requete est infaisable d'emblee (obligatoire invalide,
+ *         exclu, inaccessible ou ne menant pas a la destination), 1 sinon
+ * @complexity O((V + E) log V + k (V + E))
+ */
+static int preparer_requete(const Graphe* g, int source, int destination,
+                            const Contraintes* c, const OptionsBacktrack* opt,
+                            RequeteBT* rq) {
+    int V = g->capacite_max;
+    int amorcer = opt && opt->amorcer;
+    int* succ_lat  = amorcer ? (int*)malloc(V * sizeof(int)) : NULL;
+    int* succ_cout = amorcer ? (int*)malloc(V * sizeof(int)) : NULL;
+    GrapheCSR* inverse = construire_csr(g, 1, c);
+    rq->h_lat  = (float*)malloc(V * sizeof(float));
+    rq->h_cout = (float*)malloc(V * sizeof(float));
+    dijkstra_csr(inverse, destination, CRITERE_LATENCE, rq->h_lat, succ_lat);
+    dijkstra_csr(inverse, destination, CRITERE_COUT,    rq->h_cout, succ_cout);
+    rq->amorce      = NULL;
+    rq->amorce_long = 0;
+
+    rq->exclu = creer_bitset(V);
+    for (int i = 0; i < c->nb_exclus; i++) {
+        int x = c->noeuds_exclus[i];
+        if (x >= 0 && x < V) BITSET_AJOUTER(rq->exclu, x);
+    }
+
+    rq->index_oblig  = (int*)malloc(V * sizeof(int));
+    rq->oblig        = (int*)malloc((c->nb_obligatoires + 1) * sizeof(int));
+    rq->entrees_init = (int*)calloc(V, sizeof(int));
+    rq->debut_oblig  = NULL;
+    rq->cible_oblig  = NULL;
+    rq->nb_oblig     = 0;
+    for (int v = 0; v < V; v++) rq->index_oblig[v] = -1;
+
+    int faisable = 1;
+    for (int i = 0; i < c->nb_obligatoires; i++) {
+        int m = c->noeuds_oblgatoires[i];
+        if (m < 0 || m >= V || !noeud_existe(g, m) ||
+            BITSET_TEST(rq->exclu, m) || rq->h_lat[m] == INFINI) {
+            faisable = 0;
+            continue;
+        }
+        if (rq->index_oblig[m] >= 0) continue;       /* doublon */
+        rq->index_oblig[m] = rq->nb_oblig;
+        rq->oblig[rq->nb_oblig++] = m;
+    }
+
+    /* Sous-graphe utile : arcs admissibles entre noeuds atteignables depuis
+       la source, menant a la destination, et situes avant ou apres chaque
+       obligatoire (tout chemin valide passe par lui) */
+    rq->avant = construire_csr(g, 0, c);
+    char* utile = (char*)calloc(V, sizeof(char));
+    marquer_accessibles_csr(rq->avant, source, utile);
+    for (int v = 0; v < V; v++)
+        if (rq->h_lat[v] == INFINI) utile[v] = 0;
+    if (rq->nb_oblig > 0) {
+        char* apres = (char*)malloc(V * sizeof(char));
+        char* avant = (char*)malloc(V * sizeof(char));
+        for (int i = 0; i < rq->nb_oblig && faisable; i++) {
+            int m = rq->oblig[i];
+            if (!utile[m]) { faisable = 0; break; }
+            memset(apres, 0, V); memset(avant, 0, V);
+            marquer_accessibles_csr(rq->avant, m, apres);
+            marquer_accessibles_csr(inverse, m, avant);
+            for (int v = 0; v < V; v++)
+                if (!apres[v] && !avant[v]) utile[v] = 0;
+        }
+        free(apres); free(avant);
+    }
+    if (!utile[source]) faisable = 0;
+    restreindre_csr(rq->avant, utile);
+    rq->noeuds_utiles = 0;
+    for (int v = 0; v < V; v++) rq->noeuds_utiles += utile[v];
+    free(utile);
+    detruire_csr(inverse);
+
+    if (opt && opt->ordonner_voisins) trier_voisins(rq->avant, rq->h_lat);
+
+    if (amorcer && faisable) {
+        essayer_amorce(rq, succ_lat,  CRITERE_LATENCE, source, destination, c);
+        essayer_amorce(rq, succ_cout, CRITERE_COUT,    source, destination, c);
+    }
+    free(succ_lat);
+    free(succ_cout);
+    if (rq->nb_oblig == 0) return faisable;
+
+    /* Aretes admissibles x -> obligatoire, rangees par origine */
+    const GrapheCSR* a = rq->avant;
+    rq->debut_oblig = (int*)calloc(V + 1, sizeof(int));
+    for (int x = 0; x < V; x++) {
+        rq->debut_oblig[x + 1] = rq->debut_oblig[x];
+        if (BITSET_TEST(rq->exclu, x)) continue;
+        for (int e = a->debut[x]; e < a->debut[x + 1]; e++)
+            if (rq->index_oblig[a->voisin[e]] >= 0) rq->debut_oblig[x + 1]++;
+    }
+    rq->cible_oblig = (int*)malloc((rq->debut_oblig[V] + 1) * sizeof(int));
+    for (int x = 0, k = 0; x < V; x++) {
+        if (BITSET_TEST(rq->exclu, x)) continue;
+        for (int e = a->debut[x]; e < a->debut[x + 1]; e++)
+            if (rq->index_oblig[a->voisin[e]] >= 0) {
+                rq->cible_oblig[k++] = a->voisin[e];
+                rq->entrees_init[a->voisin[e]]++;
+            }
+    }
+    return faisable;
+}
+
+static void liberer_requete(RequeteBT* rq) {
+    free(rq->h_lat); free(rq->h_cout); free(rq->exclu);
+    detruire_csr(rq->avant); free(rq->amorce);
+    free(rq->index_oblig); free(rq->oblig); free(rq->entrees_init);
+    free(rq->debut_oblig); free(rq->cible_oblig);
 }
 
 /* ============================================================
- *  ALGORITHME PRINCIPAL DE BACKTRACKING RECURSIF
+ *  MEILLEUR CHEMIN (local ou partage)
+ *
+ *  En parallele, la meilleure latence est un entier atomique contenant
+ *  les bits du float : pour des flottants positifs, l'ordre des bits est
+ *  celui des valeurs, une lecture atomique suffit pour elaguer.
  * ============================================================ */
 
+static float bits_vers_float(unsigned u) { float f; memcpy(&f, &u, sizeof f); return f; }
+static unsigned float_vers_bits(float f) { unsigned u; memcpy(&u, &f, sizeof u); return u; }
+
+static float meilleure_latence(const ContextBacktrack* ctx) {
+    if (ctx->partage) return bits_vers_float(atomic_load(&ctx->partage->meilleure_bits));
+    if (ctx->k_meilleurs) {
+        const TasCheminsBT* tas = ctx->k_meilleurs;
+        return tas->nb < tas->k ? INFINI : tas->t[0].lat;
+    }
+    return ctx->meilleure_lat;
+}
+
+static void echanger_candidats(CandidatBT* a, CandidatBT* b) {
+    CandidatBT t = *a; *a = *b; *b = t;
+}
+
 /**
- * @brief Exploration recursive avec backtracking et elagage
- *
- * @param ctx         Contexte partage de l'exploration
- * @param noeud       Noeud actuellement explore
- * @param lat_acc     Latence cumulee jusqu'ici
- * @param cout_acc    Cout cumule jusqu'ici
- * @param bw_min_acc  Bande passante minimale rencontree (goulot)
+ * @brief Ajoute chemin[0..d] au tas des K meilleurs (l'appelant a verifie
+ *        qu'il bat le K-ieme) ; tas plein : le K-ieme est remplace
+ * @complexity O(d + log K)
+ */
+static void tas_chemins_inserer(ContextBacktrack* ctx, int d) {
+    TasCheminsBT* tas = ctx->k_meilleurs;
+    int i;
+    if (tas->nb == tas->capa && tas->nb < tas->k) {
+        int capa = tas->capa <= tas->k / 2 ? 2 * tas->capa : tas->k;
+        CandidatBT* t = (CandidatBT*)realloc(tas->t, capa * sizeof(CandidatBT));
+        /* Memoire epuisee : on garde les tas->nb meilleurs */
+        if (t) { tas->t = t; tas->capa = capa; }
+        else tas->k = tas->nb;
+    }
+    if (tas->nb < tas->k) {
+        i = tas->nb++;
+        tas->t[i].noeuds = (int*)malloc((d + 1) * sizeof(int));
+    } else {
+        i = 0;
+        tas->t[0].noeuds = (int*)realloc(tas->t[0].noeuds, (d + 1) * sizeof(int));
+    }
+    CandidatBT* c = &tas->t[i];
+    memcpy(c->noeuds, ctx->chemin, (d + 1) * sizeof(int));
+    c->longueur = d + 1;
+    c->lat  = ctx->lat[d];
+    c->cout = ctx->cout[d];
+    c->bw   = ctx->bw[d];
+
+    /* Remontee (ajout) puis descente (remplacement de la racine) */
+    while (i > 0 && tas->t[(i - 1) / 2].lat < tas->t[i].lat) {
+        echanger_candidats(&tas->t[(i - 1) / 2], &tas->t[i]);
+        i = (i - 1) / 2;
+    }
+    for (;;) {
+        int g = 2 * i + 1, dr = g + 1, m = i;
+        if (g  < tas->nb && tas->t[g].lat  > tas->t[m].lat) m = g;
+        if (dr < tas->nb && tas->t[dr].lat > tas->t[m].lat) m = dr;
+        if (m == i) break;
+        echanger_candidats(&tas->t[i], &tas->t[m]);
+        i = m;
+    }
+}
+
+/**
+ * @brief Enregistre chemin[0..d] s'il bat le meilleur connu
+ * @return 1 si c'est un nouveau record
+ * @complexity O(d), seulement lors d'un nouveau record
+ */
+static int proposer_meilleur(ContextBacktrack* ctx, int d) {
+    float lat = ctx->lat[d];
+    PartageBT* p = ctx->partage;
+    int record = 0;
+    if (!p) {
+        if (ctx->k_meilleurs && lat < meilleure_latence(ctx)) {
+            tas_chemins_inserer(ctx, d);
+            record = 1;
+        }
+        if (lat < ctx->meilleure_lat) {
+            memcpy(ctx->meilleur, ctx->chemin, (d + 1) * sizeof(int));
+            ctx->meilleur_long = d + 1;
+            ctx->meilleure_lat = lat;
+            ctx->meilleur_cout = ctx->cout[d];
+            ctx->meilleur_bw   = ctx->bw[d];
+            record = 1;
+        }
+        return record;
+    }
+    pthread_mutex_lock(&p->verrou_meilleur);
+    if (lat < bits_vers_float(atomic_load(&p->meilleure_bits))) {
+        memcpy(p->meilleur, ctx->chemin, (d + 1) * sizeof(int));
+        p->meilleur_long = d + 1;
+        p->meilleur_cout = ctx->cout[d];
+        p->meilleur_bw   = ctx->bw[d];
+        atomic_store(&p->meilleure_bits, float_vers_bits(lat));
+        record = 1;
+    }
+    pthread_mutex_unlock(&p->verrou_meilleur);
+    return record;
+}
+
+static Chemin* construire_resultat(const int* noeuds, int longueur,
+                                   float lat, float cout, float bw) {
+    if (longueur == 0) return NULL;
+    Chemin* c = creer_chemin();
+    /* Insertion en tete depuis la fin : O(longueur) au lieu de O(longueur^2) */
+    for (int i = longueur - 1; i >= 0; i--) {
+        NoeudChemin* n = (NoeudChemin*)malloc(sizeof(NoeudChemin));
+        n->id_noeud = noeuds[i];
+        n->suivant  = c->tete;
+        c->tete     = n;
+    }
+    c->longueur = longueur;
+    c->latence_totale = lat;
+    c->cout_total     = cout;
+    c->bw_minimale    = bw;
+    return c;
+}
+
+/* ============================================================
+ *  LIMITES ET PROGRESSION
+ * ============================================================ */
+
+/**
+ * @brief Appelle le rappel de progression avec le meilleur chemin courant
+ */
+static void rappeler_progression(ContextBacktrack* ctx) {
+    const OptionsBacktrack* opt = ctx->opt;
+    PartageBT* p = ctx->partage;
+    StatsBacktrack instant = ctx->stats;
+    instant.temps_ms = temps_ms() - ctx->t_debut;
+    ctx->dernier_rappel = instant.temps_ms;
+
+    Chemin* meilleur;
+    if (!p) {
+        meilleur = construire_resultat(ctx->meilleur, ctx->meilleur_long,
+                                       ctx->meilleure_lat, ctx->meilleur_cout,
+                                       ctx->meilleur_bw);
+        opt->progression(meilleur, &instant, opt->donnees);
+    } else {
+        pthread_mutex_lock(&p->verrou_meilleur);
+        meilleur = construire_resultat(p->meilleur, p->meilleur_long,
+                                       bits_vers_float(atomic_load(&p->meilleure_bits)),
+                                       p->meilleur_cout, p->meilleur_bw);
+        pthread_mutex_unlock(&p->verrou_meilleur);
+        instant.noeuds_explores = atomic_load(&p->noeuds_total) +
+                                  (ctx->stats.noeuds_explores - ctx->noeuds_publies);
+        pthread_mutex_lock(&p->verrou_rappel);
+        opt->progression(meilleur, &instant, opt->donnees);
+        pthread_mutex_unlock(&p->verrou_rappel);
+    }
+    detruire_chemin(meilleur);
+}
+
+/**
+ * @brief Controle periodique de l'echeance et du budget de noeuds
+ * @return 1 si la recherche doit s'arreter
  */
-static void backtrack_recursif(ContextBacktrack* ctx,
-                               int noeud,
-                               float lat_acc,
-                               float cout_acc,
-                               float bw_min_acc) {
-    ctx->noeuds_explores++;
+static int controler_limites(ContextBacktrack* ctx) {
+    const OptionsBacktrack* opt = ctx->opt;
+    PartageBT* p = ctx->partage;
+    int explores = ctx->stats.noeuds_explores;
+    ctx->prochain_controle = explores + INTERVALLE_CONTROLE;
+
+    int total = explores;
+    if (p) {
+        total = atomic_fetch_add(&p->noeuds_total, explores - ctx->noeuds_publies)
+              + (explores - ctx->noeuds_publies);
+        ctx->noeuds_publies = explores;
+        if (atomic_load(&p->arret)) ctx->arret = 1;
+    } else if (opt->max_noeuds > 0 && ctx->prochain_controle > opt->max_noeuds) {
+        ctx->prochain_controle = opt->max_noeuds;    /* budget exact en sequentiel */
+    }
+
+    double ecoule = temps_ms() - ctx->t_debut;
+    if ((opt->max_noeuds > 0 && total >= opt->max_noeuds) ||
+        (opt->delai_ms > 0 && ecoule >= opt->delai_ms)) {
+        ctx->arret = 1;
+        if (p) atomic_store(&p->arret, 1);
+    } else if (!ctx->arret && opt->progression && opt->periode_ms > 0 &&
+               ecoule - ctx->dernier_rappel >= opt->periode_ms) {
+        rappeler_progression(ctx);
+    }
+    return ctx->arret;
+}
+
+static void init_contexte(ContextBacktrack* ctx, const Graphe* g,
+                          const Contraintes* c, int destination,
+                          const RequeteBT* rq, const OptionsBacktrack* opt,
+                          double t_debut) {
+    int V = g->capacite_max;
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->g           = g;
+    ctx->contraintes = c;
+    ctx->destination = destination;
+    ctx->rq          = rq;
+    ctx->opt         = opt;
+    ctx->t_debut     = t_debut;
+    ctx->prochain_controle = INT_MAX;
+    if (opt) {
+        ctx->prochain_controle = INTERVALLE_CONTROLE;
+        if (opt->max_noeuds > 0 && opt->max_noeuds < INTERVALLE_CONTROLE)
+            ctx->prochain_controle = opt->max_noeuds;
+    }
+    ctx->chemin      = (int*)   malloc(V * sizeof(int));
+    ctx->curseur     = (int*)   malloc(V * sizeof(int));
+    ctx->lat         = (float*) malloc(V * sizeof(float));
+    ctx->cout        = (float*) malloc(V * sizeof(float));
+    ctx->bw          = (float*) malloc(V * sizeof(float));
+    ctx->visite      = (char*)  calloc(V, sizeof(char));
+    ctx->nb_vus      = (int*)   malloc(V * sizeof(int));
+    ctx->entrees     = (int*)   malloc(V * sizeof(int));
+    ctx->masque      = (uint64_t*)malloc(V * sizeof(uint64_t));
+    memcpy(ctx->entrees, rq->entrees_init, V * sizeof(int));
+
+    /* Dominance : exacte sans obligatoires, sur demande sinon */
+    int k = (opt && opt->memo_par_noeud) ? opt->memo_par_noeud : MEMO_PAR_NOEUD;
+    if (k > MEMO_PAR_NOEUD_MAX) k = MEMO_PAR_NOEUD_MAX;
+    if (rq->nb_oblig > 0 && !(opt && opt->dominance_obligatoires && rq->nb_oblig <= 64))
+        k = 0;
+    if (k > 0) {
+        ctx->memo_k  = k;
+        ctx->memo    = (EtiquetteBT*)malloc((size_t)V * k * sizeof(EtiquetteBT));
+        ctx->memo_nb = (unsigned char*)calloc(V, sizeof(unsigned char));
+    }
+    ctx->meilleur    = (int*)   malloc(V * sizeof(int));
+    ctx->meilleure_lat = INFINI;
+}
+
+static void liberer_contexte(ContextBacktrack* ctx) {
+    free(ctx->chemin); free(ctx->curseur);
+    free(ctx->lat); free(ctx->cout); free(ctx->bw);
+    free(ctx->visite); free(ctx->meilleur);
+    free(ctx->nb_vus); free(ctx->entrees); free(ctx->masque);
+    free(ctx->memo); free(ctx->memo_nb);
+}
+
+/**
+ * @brief Place un prefixe chemin[0..base] (visite, obligatoires, entrees)
+ *        ou l'efface (sens = -1 pour placer, +1 pour effacer)
+ */
+static void placer_prefixe(ContextBacktrack* ctx, const int* noeuds, int base, int sens) {
+    int vus = 0;
+    uint64_t m = 0;
+    for (int i = 0; i <= base; i++) {
+        int r = ctx->rq->index_oblig[noeuds[i]];
+        ctx->visite[noeuds[i]] = (char)(sens < 0);
+        if (i < base) ajuster_entrees(ctx, noeuds[i], sens);
+        if (r >= 0) { vus++; if (r < 64) m |= UINT64_C(1) << r; }
+        ctx->chemin[i] = noeuds[i];
+    }
+    ctx->nb_vus[base] = vus;
+    ctx->masque[base] = m;
+}
+
+/* ============================================================
+ *  MOTEUR ITERATIF DE BACKTRACKING
+ * ============================================================ */
+
+static void deque_pousser(PartageBT* p, int id, TacheBT* t);
+static int  deque_taille(DequeBT* d);
+static TacheBT* creer_tache(const int* prefixe, int longueur, int suivant,
+                            float lat, float cout, float bw);
+
+/**
+ * @brief Arrivee sur chemin[d] : elagages et cas de base
+ * @return 1 si les voisins de chemin[d] doivent etre explores, 0 sinon
+ */
+static int entrer_noeud(ContextBacktrack* ctx, int d) {
+    int   noeud    = ctx->chemin[d];
+    float lat_acc  = ctx->lat[d];
+    float cout_acc = ctx->cout[d];
+    const Contraintes* c = ctx->contraintes;
+    ctx->stats.noeuds_explores++;
+
+    /* --- Echeance / budget de noeuds --- */
+    if (ctx->stats.noeuds_explores >= ctx->prochain_controle && controler_limites(ctx))
+        return 0;
 
     /* --- ELAGAGE 1 : Depassement du budget --- */
-    if (cout_acc > ctx->contraintes->cout_max_autorise) {
-        ctx->branches_elaguees++;
-        return;
+    if (cout_acc > c->cout_max_autorise) {
+        ctx->stats.branches_elaguees++;
+        return 0;
     }
 
     /* --- ELAGAGE 2 : Latence deja pire que le meilleur connu --- */
-    if (ctx->meilleur && lat_acc >= ctx->meilleur->latence_totale) {
-        ctx->branches_elaguees++;
-        return;
+    float meilleure = meilleure_latence(ctx);
+    if (lat_acc >= meilleure) {
+        ctx->stats.branches_elaguees++;
+        return 0;
+    }
+
+    /* --- ELAGAGE 7 : Bornes inferieures sur le reste du trajet --- */
+    const RequeteBT* rq = ctx->rq;
+    if (rq->h_lat[noeud] == INFINI ||
+        cout_acc + rq->h_cout[noeud] > c->cout_max_autorise + EPS_BORNE ||
+        lat_acc + rq->h_lat[noeud] - EPS_BORNE >= meilleure) {
+        ctx->stats.branches_elaguees++;
+        ctx->stats.elagages_bornes++;
+        return 0;
     }
 
     /* --- CAS DE BASE : Arrivee a destination --- */
     if (noeud == ctx->destination) {
         /* Verifier que tous les noeuds obligatoires ont ete visites */
-        if (!tous_obligatoires_visites(ctx->courant, ctx->contraintes))
-            return;
-
-        ctx->chemins_trouves++;
-
-        /* Mettre a jour le meilleur chemin si necessaire */
-        if (!ctx->meilleur || lat_acc < ctx->meilleur->latence_totale) {
-            detruire_chemin(ctx->meilleur);
-            ctx->meilleur = copier_chemin(ctx->courant);
-            ctx->meilleur->latence_totale = lat_acc;
-            ctx->meilleur->cout_total     = cout_acc;
-            ctx->meilleur->bw_minimale    = bw_min_acc;
-        }
-        return;
+        if (ctx->nb_vus[d] < rq->nb_oblig) return 0;
+        ctx->stats.chemins_trouves++;
+        if (proposer_meilleur(ctx, d) && ctx->opt && ctx->opt->progression)
+            rappeler_progression(ctx);
+        return 0;
     }
 
-    /* --- EXPLORATION DES VOISINS --- */
-    Arete* a = ctx->g->noeuds[noeud].aretes;
-    while (a) {
-        int v = a->destination;
+    /* --- ELAGAGE 8 : Un obligatoire restant n'est plus atteignable --- */
+    if (ctx->nb_vus[d] < rq->nb_oblig && obligatoire_inaccessible(ctx)) {
+        ctx->stats.branches_elaguees++;
+        ctx->stats.elagages_obligatoires++;
+        return 0;
+    }
 
-        /* ELAGAGE 3 : Noeud deja dans le chemin courant (evite les cycles) */
-        if (ctx->visite[v]) { a = a->suivant; continue; }
+    /* --- ELAGAGE 9 : Etat domine par un etat deja atteint en ce noeud --- */
+    if (ctx->memo_k &&
+        domine_ou_memorise(ctx, noeud, lat_acc, cout_acc, ctx->bw[d], ctx->masque[d])) {
+        ctx->stats.branches_elaguees++;
+        ctx->stats.elagages_dominance++;
+        return 0;
+    }
 
-        /* ELAGAGE 4 : Noeud exclu */
-        if (noeud_exclu(v, ctx->contraintes)) { a = a->suivant; continue; }
+    ctx->curseur[d] = rq->avant->debut[noeud];
+    return 1;
+}
 
-        /* ELAGAGE 5 : Arete invalide (BW ou securite insuffisante) */
-        if (!arete_valide(a, ctx->contraintes)) { a = a->suivant; continue; }
+/**
+ * @brief Exploration en profondeur a pile explicite depuis chemin[base]
+ *
+ * chemin[0..base], visite[] et les cumuls a la profondeur base doivent
+ * etre renseignes par l'appelant. Aucune allocation dans la boucle
+ * (sauf publication de taches en mode parallele).
+ */
+static void explorer(ContextBacktrack* ctx, int base) {
+    /* ELAGAGES 4 et 5 (exclus, BW / securite) : deja faits par le CSR avant */
+    const GrapheCSR* a = ctx->rq->avant;
+    PartageBT* p = ctx->partage;
+    if (!entrer_noeud(ctx, base)) return;
 
-        /* --- AVANCER : Choisir ce voisin --- */
-        ctx->visite[v] = 1;
-        ajouter_noeud_chemin(ctx->courant, v);
+    int d = base;
+    while (d >= base && !ctx->arret) {
+        /* --- Prochain voisin admissible de chemin[d] --- */
+        int e = ctx->curseur[d], fin = a->debut[ctx->chemin[d] + 1];
+        while (e < fin && ctx->visite[a->voisin[e]])        /* ELAGAGE 3 : cycle */
+            e++;
 
-        float nouvelle_bw = (bw_min_acc < a->bande_passante) ?
-                             bw_min_acc : a->bande_passante;
+        if (e == fin) {
+            /* --- RETOUR ARRIERE : plus de voisin a essayer --- */
+            if (d > base) {
+                ctx->visite[ctx->chemin[d]] = 0;
+                ajuster_entrees(ctx, ctx->chemin[d - 1], +1);
+            }
+            d--;
+            continue;
+        }
+        ctx->curseur[d] = e + 1;
 
-        /* Recursion */
-        backtrack_recursif(ctx, v,
-                           lat_acc  + a->latence,
-                           cout_acc + a->cout,
-                           nouvelle_bw);
+        int   v  = a->voisin[e];
+        float nl = ctx->lat[d] + a->latence[e];
+        float nc = ctx->cout[d] + a->cout[e];
+        float nb = ctx->bw[d] < a->bande_passante[e] ? ctx->bw[d] : a->bande_passante[e];
 
-        /* --- RETOUR ARRIERE : Annuler le choix --- */
-        retirer_dernier_noeud(ctx->courant);
-        ctx->visite[v] = 0;
+        /* Decoupage dynamique : un thread attend, on lui cede ce sous-arbre */
+        if (p && d < PROF_DECOUPE_MAX && atomic_load(&p->nb_inactifs) > 0 &&
+            deque_taille(&p->deques[ctx->id]) < 2) {
+            deque_pousser(p, ctx->id, creer_tache(ctx->chemin, d + 1, v, nl, nc, nb));
+            continue;
+        }
 
-        a = a->suivant;
+        /* --- AVANCER : Choisir ce voisin --- */
+        ctx->chemin[d + 1] = v;
+        ctx->lat[d + 1]    = nl;
+        ctx->cout[d + 1]   = nc;
+        ctx->bw[d + 1]     = nb;
+        ctx->visite[v]     = 1;
+        int r = ctx->rq->index_oblig[v];
+        ctx->nb_vus[d + 1] = ctx->nb_vus[d] + (r >= 0);
+        ctx->masque[d + 1] = ctx->masque[d] | ((r >= 0 && r < 64) ? UINT64_C(1) << r : 0);
+        ajuster_entrees(ctx, ctx->chemin[d], -1);
+        if (entrer_noeud(ctx, d + 1)) d++;
+        else {
+            ctx->visite[v] = 0;
+            ajuster_entrees(ctx, ctx->chemin[d], +1);
+        }
     }
 }
 
@@ -181,65 +893,633 @@ static void backtrack_recursif(ContextBacktrack* ctx,
 Chemin* chemin_contraint_backtracking(const Graphe* g, int source,
                                       int destination,
                                       const Contraintes* c) {
-    StatsBacktrack stats = {0, 0, 0, 0.0};
-    return backtracking_avec_stats(g, source, destination, c, &stats);
+    StatsBacktrack stats = {0};
+    OptionsBacktrack opt = {0};
+    opt.amorcer          = 1;
+    opt.ordonner_voisins = 1;
+    return backtracking_avec_stats(g, source, destination, c, &opt, &stats);
 }
 
 Chemin* backtracking_avec_stats(const Graphe* g, int source,
                                 int destination,
                                 const Contraintes* c,
+                                const OptionsBacktrack* opt,
                                 StatsBacktrack* stats) {
     if (!g || !noeud_existe(g, source) || !noeud_existe(g, destination))
         return NULL;
 
     double t_debut = temps_ms();
 
-    /* Initialiser le contexte */
+    RequeteBT rq;
+    int faisable = preparer_requete(g, source, destination, c, opt, &rq);
+
+    /* Initialiser le contexte avec la source a la profondeur 0 */
     ContextBacktrack ctx;
-    ctx.g             = g;
-    ctx.contraintes   = c;
-    ctx.destination   = destination;
-    ctx.visite        = (int*)calloc(g->capacite_max, sizeof(int));
-    ctx.meilleur      = NULL;
-    ctx.courant       = creer_chemin();
-    ctx.noeuds_explores  = 0;
-    ctx.branches_elaguees = 0;
-    ctx.chemins_trouves  = 0;
-
-    /* Initialiser le chemin courant avec la source */
-    ajouter_noeud_chemin(ctx.courant, source);
-    ctx.visite[source] = 1;
+    init_contexte(&ctx, g, c, destination, &rq, opt, t_debut);
+    if (rq.amorce_long > 0) {
+        memcpy(ctx.meilleur, rq.amorce, rq.amorce_long * sizeof(int));
+        ctx.meilleur_long = rq.amorce_long;
+        ctx.meilleure_lat = rq.amorce_lat;
+        ctx.meilleur_cout = rq.amorce_cout;
+        ctx.meilleur_bw   = rq.amorce_bw;
+    }
+    placer_prefixe(&ctx, &source, 0, -1);
+    ctx.lat[0] = 0.0f; ctx.cout[0] = 0.0f; ctx.bw[0] = INFINI;
 
     /* Lancer le backtracking */
-    backtrack_recursif(&ctx, source, 0.0f, 0.0f, INFINI);
+    if (faisable) explorer(&ctx, 0);
 
     /* Collecter les statistiques */
     if (stats) {
-        stats->noeuds_explores   = ctx.noeuds_explores;
-        stats->branches_elaguees = ctx.branches_elaguees;
-        stats->chemins_trouves   = ctx.chemins_trouves;
-        stats->temps_ms          = temps_ms() - t_debut;
+        *stats = ctx.stats;
+        /* Dominance avec obligatoires : coupe heuristique */
+        stats->noeuds_sous_graphe = rq.noeuds_utiles;
+        stats->arcs_sous_graphe   = rq.avant->nb_arcs;
+        stats->optimalite_prouvee = !ctx.arret &&
+            !(rq.nb_oblig > 0 && ctx.stats.elagages_dominance > 0);
+        stats->temps_ms = temps_ms() - t_debut;
     }
 
+    Chemin* meilleur = construire_resultat(ctx.meilleur, ctx.meilleur_long,
+                                           ctx.meilleure_lat, ctx.meilleur_cout,
+                                           ctx.meilleur_bw);
     /* Nettoyage */
-    free(ctx.visite);
-    detruire_chemin(ctx.courant);
+    liberer_contexte(&ctx);
+    liberer_requete(&rq);
+    return meilleur;
+}
+
+static int comparer_candidats(const void* a, const void* b) {
+    const CandidatBT* x = (const CandidatBT*)a;
+    const CandidatBT* y = (const CandidatBT*)b;
+    if (x->lat != y->lat) return x->lat < y->lat ? -1 : 1;
+    return x->longueur - y->longueur;
+}
+
+Chemin* k_chemins_contraints(const Graphe* g, int source, int destination,
+                             const Contraintes* c, int k,
+                             const OptionsBacktrack* opt,
+                             StatsBacktrack* stats) {
+    if (!g || !c || k < 1 || !noeud_existe(g, source) || !noeud_existe(g, destination))
+        return NULL;
+    double t_debut = temps_ms();
+
+    /* Un etat domine ou un chemin d'amorce peuvent encore fournir l'un des
+       K meilleurs (ou le dupliquer) : dominance et amorce desactivees */
+    OptionsBacktrack o = {0};
+    if (opt) o = *opt;
+    o.memo_par_noeud = -1;
+    o.amorcer        = 0;
+
+    RequeteBT rq;
+    int faisable = preparer_requete(g, source, destination, c, &o, &rq);
+
+    TasCheminsBT tas;
+    tas.k    = k;
+    tas.nb   = 0;
+    tas.capa = k < TAS_K_CAPA_INIT ? k : TAS_K_CAPA_INIT;
+    tas.t    = (CandidatBT*)malloc(tas.capa * sizeof(CandidatBT));
+    if (!tas.t) { liberer_requete(&rq); return NULL; }
+
+    ContextBacktrack ctx;
+    init_contexte(&ctx, g, c, destination, &rq, &o, t_debut);
+    ctx.k_meilleurs = &tas;
+    placer_prefixe(&ctx, &source, 0, -1);
+    ctx.lat[0] = 0.0f; ctx.cout[0] = 0.0f; ctx.bw[0] = INFINI;
+    if (faisable) explorer(&ctx, 0);
 
-    return ctx.meilleur;
+    if (stats) {
+        *stats = ctx.stats;
+        stats->noeuds_sous_graphe = rq.noeuds_utiles;
+        stats->arcs_sous_graphe   = rq.avant->nb_arcs;
+        stats->optimalite_prouvee = !ctx.arret;
+        stats->temps_ms = temps_ms() - t_debut;
+    }
+
+    /* Liste par latence croissante, chainee par le champ suivant */
+    qsort(tas.t, tas.nb, sizeof(CandidatBT), comparer_candidats);
+    Chemin* liste = NULL;
+    for (int i = tas.nb - 1; i >= 0; i--) {
+        Chemin* ch = construire_resultat(tas.t[i].noeuds, tas.t[i].longueur,
+                                         tas.t[i].lat, tas.t[i].cout, tas.t[i].bw);
+        ch->suivant = liste;
+        liste = ch;
+        free(tas.t[i].noeuds);
+    }
+    free(tas.t);
+    liberer_contexte(&ctx);
+    liberer_requete(&rq);
+    return liste;
+}
+
+/* ============================================================
+ *  BACKTRACKING PARALLELE (separation et evaluation, vol de taches)
+ *
+ *  - Tache = prefixe de chemin depuis la source (noeuds + cumuls)
+ *  - Decoupage initial : expansion en largeur des premiers niveaux
+ *    jusqu'a ~TACHES_PAR_THREAD taches par thread
+ *  - Decoupage dynamique : a faible profondeur, si un thread est inactif,
+ *    les voisins restants sont publies comme taches au lieu d'etre explores
+ *  - Chaque thread a sa deque : il depile par le bas (LIFO, localite),
+ *    les voleurs prennent par le haut (les plus gros sous-arbres)
+ *  - Chaque thread execute le meme moteur iteratif que le mode sequentiel
+ * ============================================================ */
+
+static TacheBT* creer_tache(const int* prefixe, int longueur, int suivant,
+                            float lat, float cout, float bw) {
+    int n = longueur + (suivant >= 0);
+    TacheBT* t = (TacheBT*)malloc(sizeof(TacheBT) + n * sizeof(int));
+    memcpy(t->noeuds, prefixe, longueur * sizeof(int));
+    if (suivant >= 0) t->noeuds[longueur] = suivant;
+    t->longueur = n; t->lat = lat; t->cout = cout; t->bw = bw;
+    return t;
+}
+
+static void deque_pousser(PartageBT* p, int id, TacheBT* t) {
+    DequeBT* d = &p->deques[id];
+    atomic_fetch_add(&p->taches_restantes, 1);
+    pthread_mutex_lock(&d->verrou);
+    if (d->bas == d->capa) {
+        /* Compacter, puis agrandir si necessaire */
+        int n = d->bas - d->haut;
+        memmove(d->t, d->t + d->haut, n * sizeof(TacheBT*));
+        d->haut = 0; d->bas = n;
+        if (n >= d->capa / 2) {
+            d->capa *= 2;
+            d->t = (TacheBT**)realloc(d->t, d->capa * sizeof(TacheBT*));
+        }
+    }
+    d->t[d->bas++] = t;
+    pthread_mutex_unlock(&d->verrou);
+}
+
+static TacheBT* deque_prendre(DequeBT* d, int par_le_haut) {
+    TacheBT* t = NULL;
+    pthread_mutex_lock(&d->verrou);
+    if (d->haut < d->bas) t = par_le_haut ? d->t[d->haut++] : d->t[--d->bas];
+    pthread_mutex_unlock(&d->verrou);
+    return t;
+}
+
+static int deque_taille(DequeBT* d) {
+    pthread_mutex_lock(&d->verrou);
+    int n = d->bas - d->haut;
+    pthread_mutex_unlock(&d->verrou);
+    return n;
+}
+
+static void* worker_backtracking(void* arg) {
+    ContextBacktrack* ctx = (ContextBacktrack*)arg;
+    PartageBT* p = ctx->partage;
+    int inactif = 0;
+
+    while (1) {
+        TacheBT* t = deque_prendre(&p->deques[ctx->id], 0);
+        for (int k = 1; !t && k < p->nb_workers; k++)
+            t = deque_prendre(&p->deques[(ctx->id + k) % p->nb_workers], 1);
+
+        if (!t) {
+            if (atomic_load(&p->taches_restantes) == 0) break;
+            if (!inactif) { inactif = 1; atomic_fetch_add(&p->nb_inactifs, 1); }
+            sched_yield();
+            continue;
+        }
+        if (inactif) { inactif = 0; atomic_fetch_sub(&p->nb_inactifs, 1); }
+
+        /* Apres l'arret, les taches restantes sont seulement videes */
+        if (!ctx->arret && !atomic_load(&p->arret)) {
+            int base = t->longueur - 1;
+            placer_prefixe(ctx, t->noeuds, base, -1);
+            ctx->lat[base] = t->lat; ctx->cout[base] = t->cout; ctx->bw[base] = t->bw;
+            explorer(ctx, base);
+            placer_prefixe(ctx, t->noeuds, base, +1);
+        }
+
+        free(t);
+        atomic_fetch_sub(&p->taches_restantes, 1);
+    }
+    if (inactif) atomic_fetch_sub(&p->nb_inactifs, 1);
+    return NULL;
+}
+
+/**
+ * @brief Decoupage initial : expansion en largeur des prefixes
+ * @return Liste de taches (tableau alloue), *nb = sa taille
+ */
+static TacheBT** decouper_initial(const ContextBacktrack* ref, int source,
+                                  int objectif, int* nb, StatsBacktrack* stats) {
+    const Contraintes* c = ref->contraintes;
+    const GrapheCSR* a = ref->rq->avant;
+    float meilleure = meilleure_latence(ref);
+    int capa = 16, n = 1;
+    TacheBT** niveau = (TacheBT**)malloc(capa * sizeof(TacheBT*));
+    niveau[0] = creer_tache(&source, 1, -1, 0.0f, 0.0f, INFINI);
+
+    for (int prof = 0; prof < PROF_DECOUPE_MAX && n > 0 && n < objectif; prof++) {
+        int capa_s = 16, n_s = 0;
+        TacheBT** suivant = (TacheBT**)malloc(capa_s * sizeof(TacheBT*));
+        for (int i = 0; i < n; i++) {
+            TacheBT* t = niveau[i];
+            int u = t->noeuds[t->longueur - 1];
+            if (u == ref->destination) {     /* Chemin complet : garde tel quel */
+                if (n_s == capa_s) suivant = (TacheBT**)realloc(suivant, (capa_s *= 2) * sizeof(TacheBT*));
+                suivant[n_s++] = t;
+                continue;
+            }
+            stats->noeuds_explores++;
+            for (int e = a->debut[u]; e < a->debut[u + 1]; e++) {
+                int v = a->voisin[e], deja = 0;
+                for (int j = 0; j < t->longueur && !deja; j++) deja = (t->noeuds[j] == v);
+                if (deja) continue;
+                float nl = t->lat + a->latence[e];
+                float nc = t->cout + a->cout[e];
+                if (ref->rq->h_lat[v] == INFINI ||
+                    nc + ref->rq->h_cout[v] > c->cout_max_autorise + EPS_BORNE ||
+                    nl + ref->rq->h_lat[v] - EPS_BORNE >= meilleure) {
+                    stats->branches_elaguees++;
+                    stats->elagages_bornes++;
+                    continue;
+                }
+                if (n_s == capa_s) suivant = (TacheBT**)realloc(suivant, (capa_s *= 2) * sizeof(TacheBT*));
+                suivant[n_s++] = creer_tache(t->noeuds, t->longueur, v, nl, nc,
+                                             t->bw < a->bande_passante[e] ? t->bw : a->bande_passante[e]);
+            }
+            free(t);
+        }
+        free(niveau);
+        niveau = suivant; n = n_s;
+    }
+    *nb = n;
+    return niveau;
+}
+
+Chemin* backtracking_parallele(const Graphe* g, int source, int destination,
+                               const Contraintes* c, int nb_threads,
+                               const OptionsBacktrack* opt,
+                               StatsBacktrack* stats) {
+    if (!g || !c || !noeud_existe(g, source) || !noeud_existe(g, destination))
+        return NULL;
+    double t_debut = temps_ms();
+    int V = g->capacite_max;
+    int W = nb_threads > 0 ? nb_threads : nb_threads_disponibles();
+
+    RequeteBT rq;
+    int faisable = preparer_requete(g, source, destination, c, opt, &rq);
+
+    PartageBT p;
+    atomic_init(&p.meilleure_bits, float_vers_bits(rq.amorce_long ? rq.amorce_lat : INFINI));
+    pthread_mutex_init(&p.verrou_meilleur, NULL);
+    p.meilleur = (int*)malloc(V * sizeof(int));
+    p.meilleur_long = rq.amorce_long;
+    p.meilleur_cout = rq.amorce_cout; p.meilleur_bw = rq.amorce_bw;
+    if (rq.amorce_long) memcpy(p.meilleur, rq.amorce, rq.amorce_long * sizeof(int));
+    p.nb_workers = W;
+    atomic_init(&p.taches_restantes, 0);
+    atomic_init(&p.nb_inactifs, 0);
+    atomic_init(&p.noeuds_total, 0);
+    atomic_init(&p.arret, 0);
+    pthread_mutex_init(&p.verrou_rappel, NULL);
+    p.deques = (DequeBT*)calloc(W, sizeof(DequeBT));
+    for (int i = 0; i < W; i++) {
+        p.deques[i].capa = 64;
+        p.deques[i].t = (TacheBT**)malloc(64 * sizeof(TacheBT*));
+        pthread_mutex_init(&p.deques[i].verrou, NULL);
+    }
+
+    ContextBacktrack* workers = (ContextBacktrack*)malloc(W * sizeof(ContextBacktrack));
+    for (int i = 0; i < W; i++) {
+        init_contexte(&workers[i], g, c, destination, &rq, opt, t_debut);
+        workers[i].partage = &p;
+        workers[i].id = i;
+    }
+
+    StatsBacktrack total = {0};
+    if (faisable) {
+        int nb_taches = 0;
+        TacheBT** taches = decouper_initial(&workers[0], source, W * TACHES_PAR_THREAD,
+                                            &nb_taches, &total);
+        for (int i = 0; i < nb_taches; i++) deque_pousser(&p, i % W, taches[i]);
+        free(taches);
+    }
+
+    /* Un worker sans thread : ses taches sont volees, puis il s'execute a vide */
+    executer_en_parallele(worker_backtracking, workers, sizeof(ContextBacktrack), W);
+
+    /* Agregation des statistiques par thread */
+    for (int i = 0; i < W; i++) {
+        total.noeuds_explores   += workers[i].stats.noeuds_explores;
+        total.branches_elaguees += workers[i].stats.branches_elaguees;
+        total.chemins_trouves   += workers[i].stats.chemins_trouves;
+        total.elagages_bornes   += workers[i].stats.elagages_bornes;
+        total.elagages_obligatoires += workers[i].stats.elagages_obligatoires;
+        total.elagages_dominance += workers[i].stats.elagages_dominance;
+        total.memo_insertions    += workers[i].stats.memo_insertions;
+        total.memo_evictions     += workers[i].stats.memo_evictions;
+        liberer_contexte(&workers[i]);
+    }
+    total.noeuds_sous_graphe = rq.noeuds_utiles;
+    total.arcs_sous_graphe   = rq.avant->nb_arcs;
+    total.optimalite_prouvee = !atomic_load(&p.arret) &&
+        !(rq.nb_oblig > 0 && total.elagages_dominance > 0);
+    total.temps_ms = temps_ms() - t_debut;
+    if (stats) *stats = total;
+
+    Chemin* res = construire_resultat(p.meilleur, p.meilleur_long,
+                                      bits_vers_float(atomic_load(&p.meilleure_bits)),
+                                      p.meilleur_cout, p.meilleur_bw);
+
+    for (int i = 0; i < W; i++) {
+        free(p.deques[i].t);
+        pthread_mutex_destroy(&p.deques[i].verrou);
+    }
+    pthread_mutex_destroy(&p.verrou_meilleur);
+    pthread_mutex_destroy(&p.verrou_rappel);
+    free(p.deques); free(p.meilleur); free(workers);
+    liberer_requete(&rq);
+    return res;
 }
 
 void afficher_stats_backtrack(const StatsBacktrack* stats) {
     if (!stats) return;
     printf("\n--- Statistiques Backtracking ---\n");
+    printf("  Sous-graphe utile  : %d noeuds, %d arcs\n",
+           stats->noeuds_sous_graphe, stats->arcs_sous_graphe);
     printf("  Noeuds explores    : %d\n",   stats->noeuds_explores);
     printf("  Branches elaguees  : %d\n",   stats->branches_elaguees);
     printf("  Chemins trouves    : %d\n",   stats->chemins_trouves);
+    printf("  Optimalite prouvee : %s\n",   stats->optimalite_prouvee ? "oui" : "non (interrompu)");
+    printf("  Coupes par bornes  : %d\n",   stats->elagages_bornes);
+    printf("  Obligatoires perdus: %d\n",   stats->elagages_obligatoires);
+    printf("  Etats domines      : %d (%d memorises, %d evinces)\n",
+           stats->elagages_dominance, stats->memo_insertions, stats->memo_evictions);
     printf("  Efficacite elagage : %.1f%%\n",
            stats->noeuds_explores > 0 ?
            (float)stats->branches_elaguees * 100.0f / stats->noeuds_explores : 0.0f);
     printf("  Temps execution    : %.3f ms\n", stats->temps_ms);
 }
 
+/* ============================================================
+ *  ROUTAGE PAR POINTS DE PASSAGE (Held-Karp)
+ *
+ *  Les obligatoires deviennent des points : un Dijkstra par point donne
+ *  la matrice des distances, l'ordre de visite se resout ensuite sur
+ *  cette matrice (k points) sans plus toucher au graphe.
+ *    - exact  : dp[S][j] = latence minimale depuis la source en visitant
+ *               l'ensemble S et en finissant par j, O(2^k k^2)
+ *    - approche : plus proche voisin puis 2-opt a extremites fixes
+ * ============================================================ */
+
+/**
+ * @brief Dijkstra depuis chaque point, repartis entre les threads
+ */
+typedef struct TravailPassage {
+    const GrapheCSR* csr;
+    const int*       points;  /**< Source puis obligatoires */
+    int              nb;
+    float*           dist;    /**< nb x V */
+    int*             pred;    /**< nb x V */
+    atomic_int       suivant; /**< Prochain point a traiter */
+} TravailPassage;
+
+static void* worker_passage(void* arg) {
+    TravailPassage* t = (TravailPassage*)arg;
+    size_t V = (size_t)t->csr->nb_noeuds;
+    for (;;) {
+        int i = atomic_fetch_add(&t->suivant, 1);
+        if (i >= t->nb) break;
+        dijkstra_csr(t->csr, t->points[i], CRITERE_LATENCE,
+                     t->dist + i * V, t->pred + i * V);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Ordre optimal des k points (Held-Karp)
+ * @param D     D[i * (k + 1) + j] : latence du point i au point j
+ *              (0 = source, 1..k = obligatoires)
+ * @param fin   fin[i] : latence du point i a la destination
+ * @param ordre Rangs 1..k dans l'ordre de visite
+ * @return Latence totale, INFINI si aucun ordre n'est realisable
+ * @complexity O(2^k k^2) temps, O(2^k k) memoire
+ */
+static float ordre_held_karp(const float* D, const float* fin, int k, int* ordre) {
+    if (k == 0) return fin[0];
+    int n = k + 1;
+    size_t nb_ens = (size_t)1 << k;
+    float* dp = (float*)malloc(nb_ens * k * sizeof(float));
+    signed char* par = (signed char*)malloc(nb_ens * k);
+    for (size_t i = 0; i < nb_ens * k; i++) { dp[i] = INFINI; par[i] = -1; }
+    for (int j = 0; j < k; j++) dp[((size_t)1 << j) * k + j] = D[j + 1];
+
+    /* Un sous-ensemble n'est etendu que vers des ensembles plus grands :
+       l'ordre numerique croissant suffit */
+    for (size_t S = 1; S < nb_ens; S++) {
+        for (int j = 0; j < k; j++) {
+            float base = dp[S * k + j];
+            if (!(S >> j & 1) || base == INFINI) continue;
+            for (int x = 0; x < k; x++) {
+                float arc = D[(j + 1) * n + x + 1];
+                if ((S >> x & 1) || arc == INFINI) continue;
+                size_t T = S | ((size_t)1 << x);
+                if (base + arc < dp[T * k + x]) {
+                    dp[T * k + x]  = base + arc;
+                    par[T * k + x] = (signed char)j;
+                }
+            }
+        }
+    }
+
+    size_t S = nb_ens - 1;
+    float meilleur = INFINI;
+    int j = -1;
+    for (int x = 0; x < k; x++) {
+        if (dp[S * k + x] == INFINI || fin[x + 1] == INFINI) continue;
+        if (dp[S * k + x] + fin[x + 1] < meilleur) {
+            meilleur = dp[S * k + x] + fin[x + 1];
+            j = x;
+        }
+    }
+    /* Remontee depuis le dernier point visite */
+    for (int pos = k - 1; j >= 0; pos--) {
+        ordre[pos] = j + 1;
+        int p = par[S * k + j];
+        S &= ~((size_t)1 << j);
+        j = p;
+    }
+    free(dp); free(par);
+    return meilleur;
+}
+
+/**
+ * @brief Latence d'un ordre de visite complet (source, ordre, destination)
+ */
+static float latence_ordre(const float* D, const float* fin, int k, const int* ordre) {
+    int n = k + 1, prec = 0;
+    float total = 0.0f;
+    for (int i = 0; i < k; i++) {
+        float arc = D[prec * n + ordre[i]];
+        if (arc == INFINI) return INFINI;
+        total += arc;
+        prec = ordre[i];
+    }
+    return fin[prec] == INFINI ? INFINI : total + fin[prec];
+}
+
+static void inverser_segment(int* ordre, int i, int j) {
+    for (; i < j; i++, j--) { int t = ordre[i]; ordre[i] = ordre[j]; ordre[j] = t; }
+}
+
+/**
+ * @brief Ordre approche : plus proche voisin, puis 2-opt tant qu'une
+ *        inversion de segment raccourcit la route (graphe oriente :
+ *        chaque candidat est reevalue en entier)
+ * @complexity O(k^2) + O(k^3) par passe 2-opt
+ */
+static float ordre_heuristique(const float* D, const float* fin, int k, int* ordre) {
+    int n = k + 1, prec = 0;
+    char* pris = (char*)calloc(n, sizeof(char));
+    for (int pos = 0; pos < k; pos++) {
+        int choix = -1;
+        for (int x = 1; x <= k; x++)
+            if (!pris[x] && (choix < 0 || D[prec * n + x] < D[prec * n + choix])) choix = x;
+        pris[choix] = 1;
+        ordre[pos] = choix;
+        prec = choix;
+    }
+    free(pris);
+
+    float meilleur = latence_ordre(D, fin, k, ordre);
+    int ameliore = 1;
+    while (ameliore) {
+        ameliore = 0;
+        for (int i = 0; i < k - 1; i++) {
+            for (int j = i + 1; j < k; j++) {
+                inverser_segment(ordre, i, j);
+                float l = latence_ordre(D, fin, k, ordre);
+                if (l < meilleur - EPS_BORNE) { meilleur = l; ameliore = 1; }
+                else inverser_segment(ordre, i, j);
+            }
+        }
+    }
+    return meilleur;
+}
+
+/**
+ * @brief Arc u -> v de latence minimale dans le CSR, -1 si absent
+ */
+static int arc_latence_min(const GrapheCSR* a, int u, int v) {
+    int e_min = -1;
+    for (int e = a->debut[u]; e < a->debut[u + 1]; e++)
+        if (a->voisin[e] == v && (e_min < 0 || a->latence[e] < a->latence[e_min])) e_min = e;
+    return e_min;
+}
+
+Chemin* chemin_points_passage(const Graphe* g, int source, int destination,
+                              const Contraintes* c, int nb_threads,
+                              StatsPassage* stats) {
+    StatsPassage st = {0};
+    if (stats) *stats = st;
+    if (!g || !c || !noeud_existe(g, source) || !noeud_existe(g, destination))
+        return NULL;
+    double t_debut = temps_ms();
+    int V = g->capacite_max;
+
+    /* Points : source puis obligatoires distincts (source et destination ignorees) */
+    int* points = (int*)malloc((c->nb_obligatoires + 1) * sizeof(int));
+    char* vu = (char*)calloc(V, sizeof(char));
+    int k = 0;
+    points[0] = source;
+    vu[source] = vu[destination] = 1;
+    for (int i = 0; i < c->nb_obligatoires; i++) {
+        int x = c->noeuds_oblgatoires[i];
+        if (!noeud_existe(g, x)) { free(points); free(vu); return NULL; }
+        if (vu[x]) continue;
+        vu[x] = 1;
+        points[++k] = x;
+    }
+    free(vu);
+    int n = k + 1;
+    st.nb_points   = k;
+    st.ordre_exact = (k <= PASSAGE_EXACT_MAX);
+
+    /* 1. Dijkstra depuis chaque point sur le sous-graphe filtre */
+    GrapheCSR* csr = construire_csr(g, 0, c);
+    TravailPassage t;
+    t.csr = csr; t.points = points; t.nb = n;
+    t.dist = (float*)malloc((size_t)n * V * sizeof(float));
+    t.pred = (int*)  malloc((size_t)n * V * sizeof(int));
+    atomic_init(&t.suivant, 0);
+    int W = nb_threads > 0 ? nb_threads : nb_threads_disponibles();
+    if (W > n) W = n;
+    executer_en_parallele(worker_passage, &t, 0, W);
+
+    /* 2. Matrice des distances entre points et ordre de visite */
+    float* D   = (float*)malloc((size_t)n * n * sizeof(float));
+    float* fin = (float*)malloc(n * sizeof(float));
+    for (int i = 0; i < n; i++) {
+        const float* di = t.dist + (size_t)i * V;
+        for (int j = 0; j < n; j++) D[i * n + j] = di[points[j]];
+        fin[i] = di[destination];
+    }
+    int* ordre = (int*)malloc(n * sizeof(int));
+    float lat = st.ordre_exact ? ordre_held_karp(D, fin, k, ordre)
+                               : ordre_heuristique(D, fin, k, ordre);
+
+    /* 3. Assemblage : chaque troncon remonte l'arbre de son point de depart */
+    Chemin* res = NULL;
+    if (lat != INFINI) {
+        res = creer_chemin();
+        res->bw_minimale  = INFINI;
+        res->securite_min = SECURITE_MAX;
+        NoeudChemin** queue = &res->tete;
+        int* troncon = (int*)malloc(V * sizeof(int));
+        char* passe  = (char*)calloc(V, sizeof(char));
+        int dernier = -1;
+        st.chemin_simple = 1;
+        ordre[k] = 0; /* 0 apres le dernier obligatoire : la destination */
+        for (int pos = 0, prec = 0; pos <= k; prec = ordre[pos++]) {
+            int cible = ordre[pos] ? points[ordre[pos]] : destination;
+            const int* pred = t.pred + (size_t)prec * V;
+            int m = 0;
+            for (int v = cible; v != points[prec]; v = pred[v]) troncon[m++] = v;
+            if (pos == 0) troncon[m++] = source;
+            while (m > 0) {
+                int v = troncon[--m];
+                if (dernier >= 0) {
+                    int e = arc_latence_min(csr, dernier, v);
+                    res->latence_totale += csr->latence[e];
+                    res->cout_total     += csr->cout[e];
+                    if (csr->bande_passante[e] < res->bw_minimale)
+                        res->bw_minimale = csr->bande_passante[e];
+                    if (csr->securite[e] < res->securite_min)
+                        res->securite_min = csr->securite[e];
+                }
+                NoeudChemin* nc = (NoeudChemin*)malloc(sizeof(NoeudChemin));
+                nc->id_noeud = v;
+                nc->suivant  = NULL;
+                *queue = nc;
+                queue  = &nc->suivant;
+                res->longueur++;
+                if (passe[v]) st.chemin_simple = 0;
+                passe[v] = 1;
+                dernier = v;
+            }
+        }
+        free(troncon); free(passe);
+        if (res->cout_total > c->cout_max_autorise) {
+            detruire_chemin(res);
+            res = NULL;
+        }
+    }
+
+    free(points); free(t.dist); free(t.pred);
+    free(D); free(fin); free(ordre);
+    detruire_csr(csr);
+    st.temps_ms = temps_ms() - t_debut;
+    if (stats) *stats = st;
+    return res;
+}
+
 /* ============================================================
  *  K PLUS COURTS CHEMINS (Algorithme de Yen - Diviser pour Regner)
  *
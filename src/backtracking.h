@@ -41,6 +41,30 @@
  *   4. Noeud exclu -> noeud ignore
  *   5. Noeud deja visite -> evite les cycles
  *   6. Latence actuelle >= meilleure connue -> branche abandonnee
+ *   7. Bornes inferieures (Dijkstra inverse depuis la destination sur le
+ *      sous-graphe filtre) : lat + h_lat(v) >= meilleure latence ou
+ *      cout + h_cout(v) > budget -> branche abandonnee
+ *   8. Obligatoire non visite dont toutes les aretes d'entree partent de
+ *      noeuds deja dans le chemin -> branche abandonnee
+ *   9. Dominance : un etat (latence, cout, bw, obligatoires vus) deja
+ *      atteint au meme noeud est au moins aussi bon -> branche abandonnee
+ *      (quelques etats par noeud, memoire O(V) ; exacte sans obligatoires)
+ *
+ * Les listes d'exclusions et d'obligatoires sont compilees une fois par
+ * requete (ensemble de bits, index par noeud, compteur d'obligatoires
+ * visites par profondeur) : tous les tests sont en O(1).
+ *
+ * La recherche parcourt un sous-graphe CSR precompile : aretes respectant
+ * bw / securite / exclusions, entre noeuds atteignables depuis la source,
+ * menant a la destination et situes avant ou apres chaque obligatoire.
+ *
+ * Moteur iteratif : pile explicite (noeud, arete suivante, cumuls) allouee
+ * une fois en O(V), aucune allocation pendant la recherche, le chemin n'est
+ * copie que lors d'un nouveau record. Pas de limite de profondeur liee a
+ * la pile d'appels.
+ *
+ * Utilise l'amorce par Dijkstra filtre et le tri des voisins
+ * (voir OptionsBacktrack).
  *
  * @param g           Graphe a analyser
  * @param source      ID du noeud source
@@ -91,17 +115,148 @@ typedef struct StatsBacktrack {
     int noeuds_explores;    /**< Nombre total de noeuds visites */
     int branches_elaguees;  /**< Branches abandonnees par elagage */
     int chemins_trouves;    /**< Chemins valides trouves */
+    int elagages_bornes;    /**< Dont branches coupees par les seules bornes inferieures */
+    int elagages_obligatoires; /**< Dont branches ou un obligatoire est devenu inaccessible */
+    int elagages_dominance; /**< Dont arrivees dominees par un etat memorise */
+    int memo_insertions;    /**< Etats memorises pour la dominance */
+    int memo_evictions;     /**< Etats evinces faute de place */
+    int optimalite_prouvee; /**< 1 si la recherche est allee au bout, 0 si interrompue */
+    int noeuds_sous_graphe; /**< Noeuds gardes apres filtrage et accessibilite */
+    int arcs_sous_graphe;   /**< Arcs gardes apres filtrage et accessibilite */
     double temps_ms;        /**< Temps d'execution en millisecondes */
 } StatsBacktrack;
 
 /**
- * @brief Version avec statistiques d'elagage (pour le rapport)
+ * @brief Rappel de progression : meilleur chemin courant (NULL si aucun,
+ *        detruit apres l'appel) et statistiques a cet instant
+ */
+typedef void (*RappelBacktrack)(const Chemin* meilleur,
+                                const StatsBacktrack* stats, void* donnees);
+
+/**
+ * @brief Limites et suivi d'une recherche (NULL = sans limite)
+ *
+ * A l'echeance ou au budget de noeuds, la recherche s'arrete et retourne
+ * le meilleur chemin trouve jusque-la, avec optimalite_prouvee = 0.
+ * Les limites sont controlees tous les 1024 noeuds explores.
+ */
+typedef struct OptionsBacktrack {
+    double          delai_ms;     /**< Temps maximal depuis l'appel (0 = illimite) */
+    int             max_noeuds;   /**< Noeuds explores maximum (0 = illimite) */
+    RappelBacktrack progression;  /**< Appele a chaque nouveau meilleur chemin (peut etre NULL) */
+    double          periode_ms;   /**< > 0 : rappel aussi a cet intervalle minimal */
+    void*           donnees;      /**< Transmis tel quel au rappel */
+    int             memo_par_noeud; /**< Etats de dominance par noeud (0 = 8, < 0 = aucun) */
+    int             dominance_obligatoires; /**< 1 : dominance meme avec obligatoires
+                                                 (heuristique, optimalite non prouvee) */
+    int             amorcer;      /**< 1 : meilleur chemin initial tire des arbres de
+                                       latence / cout minimaux (Dijkstra filtre) */
+    int             ordonner_voisins; /**< 1 : voisins essayes par latence + h_lat croissante */
+} OptionsBacktrack;
+
+/**
+ * @brief Version avec statistiques d'elagage (pour le rapport) et limites
+ *
+ * @param opt   Echeance, budget de noeuds, rappel de progression (peut etre NULL)
+ * @param stats Statistiques et drapeau d'optimalite (peut etre NULL)
+ * @return Meilleur chemin trouve (optimal si stats->optimalite_prouvee)
  */
 Chemin* backtracking_avec_stats(const Graphe* g, int source,
                                 int destination,
                                 const Contraintes* c,
+                                const OptionsBacktrack* opt,
                                 StatsBacktrack* stats);
 
+/**
+ * @brief Les K meilleurs chemins respectant les contraintes, en une recherche
+ *
+ * Meme moteur que backtracking_avec_stats : les chemins complets sont
+ * gardes dans un tas max borne a K elements et les elagages 6 et 7 se
+ * font contre la latence du K-ieme (aucune coupe tant que K chemins n'ont
+ * pas ete trouves). La dominance (9) et l'amorce sont desactivees : un
+ * etat domine peut mener au 2e meilleur chemin.
+ *
+ * @param k     Nombre de chemins voulus (k >= 1)
+ * @param opt   Echeance, budget de noeuds, rappel (peut etre NULL) ;
+ *              le rappel recoit le meilleur chemin trouve
+ * @param stats Statistiques (peut etre NULL)
+ * @return Liste chainee (champ suivant) d'au plus K chemins simples distincts,
+ *         par latence croissante, NULL si aucun ; a liberer avec
+ *         detruire_liste_chemins
+ * @complexity O(b^d log K) pire cas
+ */
+Chemin* k_chemins_contraints(const Graphe* g, int source, int destination,
+                             const Contraintes* c, int k,
+                             const OptionsBacktrack* opt,
+                             StatsBacktrack* stats);
+
+/**
+ * @brief Backtracking parallele par separation et evaluation
+ *
+ * L'arbre de recherche est decoupe en taches (prefixes de chemins) :
+ * decoupage initial des premiers niveaux, puis decoupage dynamique quand
+ * un thread devient inactif. Les taches sont executees par un groupe de
+ * threads avec vol de taches ; la meilleure latence connue est partagee
+ * de maniere atomique pour que tous les threads elaguent contre elle.
+ * Memes contraintes et meme latence optimale que backtracking_avec_stats
+ * (a egalite de latence, le chemin retourne peut differer).
+ *
+ * Limites : budget de noeuds global a tous les threads ; le rappel de
+ * progression est appele depuis les threads de recherche, un a la fois,
+ * avec les compteurs du thread appelant (noeuds_explores global).
+ *
+ * @param nb_threads Nombre de threads (0 = nombre de coeurs)
+ * @param opt        Comme pour backtracking_avec_stats (peut etre NULL)
+ * @param stats      Statistiques agregees de tous les threads (peut etre NULL)
+ */
+Chemin* backtracking_parallele(const Graphe* g, int source, int destination,
+                               const Contraintes* c, int nb_threads,
+                               const OptionsBacktrack* opt,
+                               StatsBacktrack* stats);
+
 void afficher_stats_backtrack(const StatsBacktrack* stats);
 
+/* ============================================================
+ *  ROUTAGE PAR POINTS DE PASSAGE (Held-Karp)
+ * ============================================================ */
+
+/** Au-dela de ce nombre de points de passage, l'ordre est heuristique */
+#define PASSAGE_EXACT_MAX 18
+
+/**
+ * @brief Statistiques du routage par points de passage
+ */
+typedef struct StatsPassage {
+    int    nb_points;      /**< Obligatoires distincts hors source et destination */
+    int    ordre_exact;    /**< 1 : ordre optimal (Held-Karp), 0 : heuristique */
+    int    chemin_simple;  /**< 1 : aucun noeud repete dans la route assemblee */
+    double temps_ms;       /**< Temps d'execution en millisecondes */
+} StatsPassage;
+
+/**
+ * @brief Route de latence minimale passant par tous les noeuds obligatoires
+ *
+ * Alternative au backtracking quand les obligatoires dominent la requete :
+ *   1. Dijkstra (latence) sur le sous-graphe filtre (bw / securite /
+ *      exclusions) depuis la source et chaque obligatoire, en parallele
+ *   2. Matrice des distances entre points, ordre de visite par
+ *      programmation dynamique sur les sous-ensembles (Held-Karp) jusqu'a
+ *      PASSAGE_EXACT_MAX points, plus proche voisin + 2-opt au-dela
+ *   3. Route assemblee en suivant les arbres de plus courts chemins
+ *
+ * Les troncons sont independants : la route peut repasser par un noeud
+ * (stats->chemin_simple = 0). Si elle est simple et l'ordre exact, sa
+ * latence est celle du backtracking. Le budget est verifie sur la route
+ * obtenue, il n'oriente pas le choix de l'ordre.
+ *
+ * @param nb_threads Threads pour les Dijkstra (0 = nombre de coeurs)
+ * @param stats      Statistiques (peut etre NULL)
+ * @return Route (latence, cout, bw, securite renseignes), NULL si un point
+ *         est inaccessible ou si le budget est depasse
+ * @complexity O(k (V + E) log V + 2^k k^2) avec k points de passage
+ */
+Chemin* chemin_points_passage(const Graphe* g, int source, int destination,
+                              const Contraintes* c, int nb_threads,
+                              StatsPassage* stats);
+
 #endif /* BACKTRACKING_H */
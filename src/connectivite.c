@@ -0,0 +1,515 @@
+/**
+ * @file connectivite.c
+ * @brief Implémentation du flot maximum (Dinic) et des coupes minimales
+ *
+ * Deux réseaux résiduels, capacités unitaires :
+ *   1. Liens : un arc par arc du graphe (capacité 1, arc retour 0) ; un
+ *      lien non orienté, déjà présent dans les deux sens, reste symétrique
+ *   2. Nœuds : v est dédoublé en v_entree = 2v et v_sortie = 2v + 1 reliés
+ *      par un arc de capacité 1 ; un arc u -> v du graphe devient
+ *      u_sortie -> v_entree de capacité infinie. Le flot part de s_sortie
+ *      et arrive à t_entree, qui ne sont donc jamais coupés
+ * Après un flot complet, le dernier BFS de Dinic (qui n'atteint plus t)
+ * marque exactement la partie de s de la coupe minimale.
+ */
+
+#include "connectivite.h"
+#include "utils.h"
+#include <limits.h>
+
+/* ============================================================
+ *  RÉSEAU RÉSIDUEL ET DINIC
+ * ============================================================ */
+
+#define FLOT_INFINI (INT_MAX / 4)
+
+typedef struct ReseauFlot {
+    int  nb_noeuds;
+    int  nb_arcs;
+    int* debut;      /**< Arcs sortants de u : [debut[u], debut[u + 1]) */
+    int* dest;
+    int* inverse;    /**< Arc retour de chaque arc */
+    int* origine;    /**< Extrémité de départ (pour la remontée du chemin) */
+    int* cap;        /**< Capacité résiduelle */
+    int* cap_init;
+    /* Espace de travail réutilisé d'un flot à l'autre */
+    int* niveau;
+    int* courant;
+    int* file;
+    int* chemin;
+} ReseauFlot;
+
+/* Paire d'arcs opposés u -> v (capacité c_uv) et v -> u (c_vu) */
+typedef struct PaireArcs {
+    int u, v, c_uv, c_vu;
+} PaireArcs;
+
+typedef struct ListePaires {
+    PaireArcs* t;
+    int nb, capa;
+} ListePaires;
+
+static void ajouter_paire(ListePaires* l, int u, int v, int c_uv, int c_vu) {
+    if (l->nb == l->capa) {
+        l->capa = l->capa ? 2 * l->capa : 64;
+        l->t = (PaireArcs*)realloc(l->t, l->capa * sizeof(PaireArcs));
+    }
+    PaireArcs p = { u, v, c_uv, c_vu };
+    l->t[l->nb++] = p;
+}
+
+static ReseauFlot* creer_reseau(int n, const ListePaires* l) {
+    ReseauFlot* r = (ReseauFlot*)calloc(1, sizeof(ReseauFlot));
+    int m = 2 * l->nb;
+    r->nb_noeuds = n;
+    r->nb_arcs   = m;
+    r->debut    = (int*)calloc(n + 2, sizeof(int));
+    r->dest     = (int*)malloc((m + 1) * sizeof(int));
+    r->inverse  = (int*)malloc((m + 1) * sizeof(int));
+    r->origine  = (int*)malloc((m + 1) * sizeof(int));
+    r->cap      = (int*)malloc((m + 1) * sizeof(int));
+    r->cap_init = (int*)malloc((m + 1) * sizeof(int));
+    r->niveau   = (int*)malloc((n + 1) * sizeof(int));
+    r->courant  = (int*)malloc((n + 1) * sizeof(int));
+    r->file     = (int*)malloc((n + 1) * sizeof(int));
+    r->chemin   = (int*)malloc((n + 1) * sizeof(int));
+
+    /* Arcs regroupés par origine (tri par dénombrement) */
+    for (int i = 0; i < l->nb; i++) {
+        r->debut[l->t[i].u + 2]++;
+        r->debut[l->t[i].v + 2]++;
+    }
+    for (int u = 0; u < n; u++) r->debut[u + 2] += r->debut[u + 1];
+    for (int i = 0; i < l->nb; i++) {
+        const PaireArcs* p = &l->t[i];
+        int a = r->debut[p->u + 1]++, b = r->debut[p->v + 1]++;
+        r->dest[a] = p->v; r->origine[a] = p->u; r->cap_init[a] = p->c_uv; r->inverse[a] = b;
+        r->dest[b] = p->u; r->origine[b] = p->v; r->cap_init[b] = p->c_vu; r->inverse[b] = a;
+    }
+    memcpy(r->cap, r->cap_init, m * sizeof(int));
+    return r;
+}
+
+static void detruire_reseau(ReseauFlot* r) {
+    if (!r) return;
+    free(r->debut); free(r->dest); free(r->inverse); free(r->origine);
+    free(r->cap); free(r->cap_init);
+    free(r->niveau); free(r->courant); free(r->file); free(r->chemin);
+    free(r);
+}
+
+static void reinitialiser_reseau(ReseauFlot* r) {
+    memcpy(r->cap, r->cap_init, r->nb_arcs * sizeof(int));
+}
+
+/* Niveaux BFS dans le résiduel ; arrêt au niveau de t (les nœuds plus
+ * loin ne servent pas). Si t n'est pas atteint, le parcours est complet :
+ * niveau[v] >= 0 <=> v du côté de s dans la coupe minimale */
+static int calculer_niveaux(ReseauFlot* r, int s, int t) {
+    for (int v = 0; v < r->nb_noeuds; v++) r->niveau[v] = -1;
+    int tete = 0, queue = 0;
+    r->niveau[s] = 0;
+    r->file[queue++] = s;
+    while (tete < queue) {
+        int u = r->file[tete++];
+        if (r->niveau[t] >= 0 && r->niveau[u] >= r->niveau[t]) break;
+        for (int e = r->debut[u]; e < r->debut[u + 1]; e++) {
+            int v = r->dest[e];
+            if (r->cap[e] <= 0 || r->niveau[v] >= 0) continue;
+            r->niveau[v] = r->niveau[u] + 1;
+            r->file[queue++] = v;
+        }
+    }
+    return r->niveau[t] >= 0;
+}
+
+/* Flot bloquant, chemin augmentant en pile explicite (limite <= 0 : aucune) */
+static int flot_bloquant(ReseauFlot* r, int s, int t, int limite) {
+    for (int v = 0; v < r->nb_noeuds; v++) r->courant[v] = r->debut[v];
+    int total = 0, h = 0, u = s;
+    for (;;) {
+        if (u == t) {
+            int f = FLOT_INFINI;
+            for (int i = 0; i < h; i++) if (r->cap[r->chemin[i]] < f) f = r->cap[r->chemin[i]];
+            if (limite > 0 && f > limite - total) f = limite - total;
+            for (int i = 0; i < h; i++) {
+                r->cap[r->chemin[i]] -= f;
+                r->cap[r->inverse[r->chemin[i]]] += f;
+            }
+            total += f;
+            if (limite > 0 && total >= limite) return total;
+            /* Reprise avant le premier arc saturé */
+            int k = 0;
+            while (k < h && r->cap[r->chemin[k]] > 0) k++;
+            h = k;
+            u = h > 0 ? r->dest[r->chemin[h - 1]] : s;
+            continue;
+        }
+        int e = r->courant[u];
+        while (e < r->debut[u + 1] &&
+               (r->cap[e] <= 0 || r->niveau[r->dest[e]] != r->niveau[u] + 1)) e++;
+        r->courant[u] = e;
+        if (e < r->debut[u + 1]) {
+            r->chemin[h++] = e;
+            u = r->dest[e];
+            continue;
+        }
+        /* Impasse : u sort du graphe de niveaux, retour d'un arc */
+        r->niveau[u] = -1;
+        if (h == 0) return total;
+        u = r->origine[r->chemin[--h]];
+    }
+}
+
+/* Flot maximum de s à t, arrêté à limite si limite > 0 */
+static int flot_max(ReseauFlot* r, int s, int t, int limite) {
+    int total = 0;
+    while (calculer_niveaux(r, s, t)) {
+        total += flot_bloquant(r, s, t, limite > 0 ? limite - total : 0);
+        if (limite > 0 && total >= limite) break;
+    }
+    return total;
+}
+
+/* ============================================================
+ *  CONSTRUCTION DES RÉSEAUX
+ * ============================================================ */
+
+static ReseauFlot* reseau_liens(const Graphe* g, int symetrique) {
+    ListePaires l = { NULL, 0, 0 };
+    for (int u = 0; u < g->capacite_max; u++) {
+        if (!g->noeuds[u].actif) continue;
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            int v = a->destination;
+            if (v == u || !noeud_existe(g, v)) continue;
+            ajouter_paire(&l, u, v, 1, symetrique ? 1 : 0);
+        }
+    }
+    ReseauFlot* r = creer_reseau(g->capacite_max, &l);
+    free(l.t);
+    return r;
+}
+
+static ReseauFlot* reseau_noeuds(const Graphe* g) {
+    ListePaires l = { NULL, 0, 0 };
+    for (int u = 0; u < g->capacite_max; u++) {
+        if (!g->noeuds[u].actif) continue;
+        ajouter_paire(&l, 2 * u, 2 * u + 1, 1, 0);
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            int v = a->destination;
+            if (v == u || !noeud_existe(g, v)) continue;
+            ajouter_paire(&l, 2 * u + 1, 2 * v, FLOT_INFINI, 0);
+        }
+    }
+    ReseauFlot* r = creer_reseau(2 * g->capacite_max, &l);
+    free(l.t);
+    return r;
+}
+
+/* Flot en nœuds : chaque lien direct s -> t ne porte qu'un chemin */
+static int flot_noeuds(ReseauFlot* r, int s, int t, int limite) {
+    reinitialiser_reseau(r);
+    int so = 2 * s + 1, ti = 2 * t;
+    for (int e = r->debut[so]; e < r->debut[so + 1]; e++)
+        if (r->dest[e] == ti && r->cap[e] > 0) r->cap[e] = 1;
+    return flot_max(r, so, ti, limite);
+}
+
+static int flot_liens(ReseauFlot* r, int s, int t, int limite) {
+    reinitialiser_reseau(r);
+    return flot_max(r, s, t, limite);
+}
+
+/* Arcs d'origine saturés de la partie de s vers celle de t */
+static void extraire_coupe_liens(const ReseauFlot* r, int valeur, CoupeMin* coupe) {
+    coupe->valeur = valeur;
+    coupe->elements = (int*)malloc((2 * valeur + 1) * sizeof(int));
+    coupe->nb = 0;
+    for (int u = 0; u < r->nb_noeuds; u++) {
+        if (r->niveau[u] < 0) continue;
+        for (int e = r->debut[u]; e < r->debut[u + 1]; e++) {
+            if (r->cap_init[e] <= 0 || r->niveau[r->dest[e]] >= 0 || coupe->nb >= valeur) continue;
+            coupe->elements[2 * coupe->nb]     = u;
+            coupe->elements[2 * coupe->nb + 1] = r->dest[e];
+            coupe->nb++;
+        }
+    }
+}
+
+/* Nœuds dont l'entrée est du côté de s et la sortie du côté de t */
+static void extraire_coupe_noeuds(const ReseauFlot* r, int valeur, CoupeMin* coupe) {
+    int V = r->nb_noeuds / 2;
+    coupe->valeur = valeur;
+    coupe->elements = (int*)malloc((valeur + 1) * sizeof(int));
+    coupe->nb = 0;
+    for (int v = 0; v < V; v++)
+        if (r->niveau[2 * v] >= 0 && r->niveau[2 * v + 1] < 0 && coupe->nb < valeur)
+            coupe->elements[coupe->nb++] = v;
+}
+
+static int paire_valide(const Graphe* g, int s, int t) {
+    return g && s != t && noeud_existe(g, s) && noeud_existe(g, t);
+}
+
+void liberer_coupe(CoupeMin* coupe) {
+    if (!coupe) return;
+    free(coupe->elements);
+    coupe->elements = NULL;
+    coupe->nb = coupe->valeur = 0;
+}
+
+/* ============================================================
+ *  CONNEXITÉ ENTRE DEUX NŒUDS
+ * ============================================================ */
+
+int connectivite_aretes(const Graphe* g, int s, int t, CoupeMin* coupe) {
+    if (!paire_valide(g, s, t)) return -1;
+    ReseauFlot* r = reseau_liens(g, 0);
+    int f = flot_liens(r, s, t, 0);
+    if (coupe) extraire_coupe_liens(r, f, coupe);
+    detruire_reseau(r);
+    return f;
+}
+
+int connectivite_noeuds(const Graphe* g, int s, int t, CoupeMin* coupe) {
+    if (!paire_valide(g, s, t)) return -1;
+    ReseauFlot* r = reseau_noeuds(g);
+    int f = flot_noeuds(r, s, t, 0);
+    if (coupe) extraire_coupe_noeuds(r, f, coupe);
+    detruire_reseau(r);
+    return f;
+}
+
+/* ============================================================
+ *  CONNEXITÉ GLOBALE
+ *  Chaque flot est arrêté au meilleur minimum connu : il ne peut plus
+ *  l'améliorer au-delà. La coupe n'est extraite qu'à la fin, par un flot
+ *  complet sur la paire retenue.
+ * ============================================================ */
+
+static int noeuds_actifs(const Graphe* g, int* ids) {
+    int n = 0;
+    for (int v = 0; v < g->capacite_max; v++) if (g->noeuds[v].actif) ids[n++] = v;
+    return n;
+}
+
+int connectivite_globale_aretes(const Graphe* g, CoupeMin* coupe) {
+    if (coupe) { coupe->valeur = 0; coupe->elements = NULL; coupe->nb = 0; }
+    if (!g) return 0;
+    int* ids = (int*)malloc((g->capacite_max + 1) * sizeof(int));
+    int n = noeuds_actifs(g, ids);
+    if (n < 2) { free(ids); return 0; }
+
+    ReseauFlot* r = reseau_liens(g, 0);
+    int meilleur = -1, bs = -1, bt = -1;
+    for (int j = 1; j < n && meilleur != 0; j++) {
+        for (int sens = 0; sens < (g->est_oriente ? 2 : 1); sens++) {
+            int s = sens ? ids[j] : ids[0], t = sens ? ids[0] : ids[j];
+            int f = flot_liens(r, s, t, meilleur);
+            if (meilleur < 0 || f < meilleur) { meilleur = f; bs = s; bt = t; }
+        }
+    }
+    if (coupe) {
+        flot_liens(r, bs, bt, 0);
+        extraire_coupe_liens(r, meilleur, coupe);
+    }
+    detruire_reseau(r);
+    free(ids);
+    return meilleur;
+}
+
+int connectivite_globale_noeuds(const Graphe* g, CoupeMin* coupe) {
+    if (coupe) { coupe->valeur = 0; coupe->elements = NULL; coupe->nb = 0; }
+    if (!g) return 0;
+    int* ids = (int*)malloc((g->capacite_max + 1) * sizeof(int));
+    int n = noeuds_actifs(g, ids);
+    if (n < 2) { free(ids); return 0; }
+
+    /* Even : le plus petit i hors d'une coupe minimale est <= κ, et
+     * l'autre côté contient un nœud d'indice plus grand */
+    ReseauFlot* r = reseau_noeuds(g);
+    int meilleur = n - 1, bs = -1, bt = -1;
+    for (int i = 0; i <= meilleur && i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            for (int sens = 0; sens < (g->est_oriente ? 2 : 1); sens++) {
+                int s = sens ? ids[j] : ids[i], t = sens ? ids[i] : ids[j];
+                if (trouver_arete(g, s, t)) continue; /* Voisins : pas de coupe */
+                int f = flot_noeuds(r, s, t, meilleur);
+                if (f < meilleur) { meilleur = f; bs = s; bt = t; }
+            }
+        }
+    }
+    if (coupe) {
+        coupe->valeur = meilleur;
+        if (bs >= 0) {
+            flot_noeuds(r, bs, bt, 0);
+            extraire_coupe_noeuds(r, meilleur, coupe);
+        }
+    }
+    detruire_reseau(r);
+    free(ids);
+    return meilleur;
+}
+
+/* ============================================================
+ *  ARBRE DE GOMORY-HU (GUSFIELD)
+ *  Tous les nœuds pendent d'abord à la racine. Pour chaque s, flot vers
+ *  t = parent[s] sur le graphe d'origine (pas de contraction) ; X = côté
+ *  de s dans la coupe :
+ *    - les nœuds de X qui pendaient à t pendent désormais à s
+ *    - si parent[t] est dans X, s prend la place de t dans l'arbre
+ *  Requêtes : plus petit poids sur le chemin, par sauts binaires.
+ * ============================================================ */
+
+ArbreCoupes* construire_arbre_coupes(const Graphe* g) {
+    if (!g) return NULL;
+    int V = g->capacite_max;
+    int* ids = (int*)malloc((V + 1) * sizeof(int));
+    int n = noeuds_actifs(g, ids);
+    ArbreCoupes* ac = (ArbreCoupes*)calloc(1, sizeof(ArbreCoupes));
+    ac->nb_sommets = V;
+    ac->racine     = n > 0 ? ids[0] : -1;
+    ac->parent     = (int*)malloc((V + 1) * sizeof(int));
+    ac->poids      = (int*)calloc(V + 1, sizeof(int));
+    ac->profondeur = (int*)calloc(V + 1, sizeof(int));
+    for (int v = 0; v < V; v++) ac->parent[v] = -1;
+    for (int i = 1; i < n; i++) ac->parent[ids[i]] = ids[0];
+
+    ReseauFlot* r = reseau_liens(g, g->est_oriente);
+    for (int i = 1; i < n; i++) {
+        int s = ids[i], t = ac->parent[s];
+        int f = flot_liens(r, s, t, 0);
+        ac->poids[s] = f;
+        for (int k = 0; k < n; k++) {
+            int x = ids[k];
+            if (x != s && r->niveau[x] >= 0 && ac->parent[x] == t) ac->parent[x] = s;
+        }
+        int pt = ac->parent[t];
+        if (pt >= 0 && r->niveau[pt] >= 0) {
+            ac->parent[s] = pt;
+            ac->parent[t] = s;
+            ac->poids[s] = ac->poids[t];
+            ac->poids[t] = f;
+        }
+    }
+    detruire_reseau(r);
+
+    /* Profondeurs dans l'ordre d'un BFS depuis la racine */
+    int* enfants_debut = (int*)calloc(V + 2, sizeof(int));
+    int* enfants = (int*)malloc((V + 1) * sizeof(int));
+    for (int v = 0; v < V; v++) if (ac->parent[v] >= 0) enfants_debut[ac->parent[v] + 2]++;
+    for (int v = 0; v < V; v++) enfants_debut[v + 2] += enfants_debut[v + 1];
+    for (int v = 0; v < V; v++) if (ac->parent[v] >= 0) enfants[enfants_debut[ac->parent[v] + 1]++] = v;
+    if (n > 0) {
+        int tete = 0, queue = 0;
+        ids[queue++] = ids[0];
+        while (tete < queue) {
+            int u = ids[tete++];
+            for (int e = enfants_debut[u]; e < enfants_debut[u + 1]; e++) {
+                ac->profondeur[enfants[e]] = ac->profondeur[u] + 1;
+                ids[queue++] = enfants[e];
+            }
+        }
+    }
+    free(enfants_debut);
+    free(enfants);
+
+    /* saut[k][v] = ancêtre à 2^k niveaux, saut_min = plus petit poids traversé */
+    int niveaux = 1;
+    while ((1 << niveaux) < (n > 1 ? n : 2)) niveaux++;
+    ac->nb_niveaux = niveaux;
+    ac->saut     = (int*)malloc(((size_t)niveaux * V + 1) * sizeof(int));
+    ac->saut_min = (int*)malloc(((size_t)niveaux * V + 1) * sizeof(int));
+    for (int v = 0; v < V; v++) {
+        ac->saut[v] = ac->parent[v];
+        ac->saut_min[v] = ac->parent[v] >= 0 ? ac->poids[v] : FLOT_INFINI;
+    }
+    for (int k = 1; k < niveaux; k++) {
+        const int* sp = ac->saut + (size_t)(k - 1) * V;
+        const int* mp = ac->saut_min + (size_t)(k - 1) * V;
+        int* sc = ac->saut + (size_t)k * V;
+        int* mc = ac->saut_min + (size_t)k * V;
+        for (int v = 0; v < V; v++) {
+            int a = sp[v];
+            sc[v] = a >= 0 ? sp[a] : -1;
+            mc[v] = a >= 0 && mp[a] < mp[v] ? mp[a] : mp[v];
+        }
+    }
+    free(ids);
+    return ac;
+}
+
+void detruire_arbre_coupes(ArbreCoupes* ac) {
+    if (!ac) return;
+    free(ac->parent); free(ac->poids); free(ac->profondeur);
+    free(ac->saut); free(ac->saut_min);
+    free(ac);
+}
+
+int coupe_min_entre(const ArbreCoupes* ac, int u, int v) {
+    if (!ac || u == v || u < 0 || v < 0 || u >= ac->nb_sommets || v >= ac->nb_sommets) return -1;
+    if ((ac->parent[u] < 0 && u != ac->racine) || (ac->parent[v] < 0 && v != ac->racine)) return -1;
+    int V = ac->nb_sommets, m = FLOT_INFINI;
+    if (ac->profondeur[u] < ac->profondeur[v]) { int x = u; u = v; v = x; }
+    for (int k = ac->nb_niveaux - 1; k >= 0; k--) {
+        if (ac->profondeur[u] - (1 << k) < ac->profondeur[v]) continue;
+        if (ac->saut_min[(size_t)k * V + u] < m) m = ac->saut_min[(size_t)k * V + u];
+        u = ac->saut[(size_t)k * V + u];
+    }
+    if (u == v) return m;
+    for (int k = ac->nb_niveaux - 1; k >= 0; k--) {
+        int au = ac->saut[(size_t)k * V + u], av = ac->saut[(size_t)k * V + v];
+        if (au == av) continue;
+        if (ac->saut_min[(size_t)k * V + u] < m) m = ac->saut_min[(size_t)k * V + u];
+        if (ac->saut_min[(size_t)k * V + v] < m) m = ac->saut_min[(size_t)k * V + v];
+        u = au; v = av;
+    }
+    if (ac->poids[u] < m) m = ac->poids[u];
+    if (ac->poids[v] < m) m = ac->poids[v];
+    return m;
+}
+
+/* ============================================================
+ *  REDONDANCE ENTRE SITES
+ * ============================================================ */
+
+int verifier_redondance(const Graphe* g, const int* sites, int nb_sites, int k,
+                        int par_noeuds, int* paires_faibles) {
+    if (!g || !sites || nb_sites < 0 || k <= 0) return -1;
+    for (int i = 0; i < nb_sites; i++) if (!noeud_existe(g, sites[i])) return -1;
+
+    int nb = 0;
+    int ordonne = g->est_oriente;
+    if (!par_noeuds && !ordonne) {
+        /* Non orienté, en liens : un seul arbre pour toutes les paires */
+        ArbreCoupes* ac = construire_arbre_coupes(g);
+        for (int i = 0; i < nb_sites; i++)
+            for (int j = i + 1; j < nb_sites; j++) {
+                if (sites[i] == sites[j] || coupe_min_entre(ac, sites[i], sites[j]) >= k) continue;
+                if (paires_faibles) {
+                    paires_faibles[2 * nb]     = sites[i];
+                    paires_faibles[2 * nb + 1] = sites[j];
+                }
+                nb++;
+            }
+        detruire_arbre_coupes(ac);
+        return nb;
+    }
+
+    /* Un flot par paire, arrêté dès k chemins trouvés */
+    ReseauFlot* r = par_noeuds ? reseau_noeuds(g) : reseau_liens(g, 0);
+    for (int i = 0; i < nb_sites; i++)
+        for (int j = ordonne ? 0 : i + 1; j < nb_sites; j++) {
+            int s = sites[i], t = sites[j];
+            if (s == t) continue;
+            int f = par_noeuds ? flot_noeuds(r, s, t, k) : flot_liens(r, s, t, k);
+            if (f >= k) continue;
+            if (paires_faibles) {
+                paires_faibles[2 * nb]     = s;
+                paires_faibles[2 * nb + 1] = t;
+            }
+            nb++;
+        }
+    detruire_reseau(r);
+    return nb;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file connectivite.h
+ * @brief k-connexité et coupes minimales par flot maximum
+ * @details Au-delà des points uniques de défaillance : combien de chemins
+ *          disjoints relient deux nœuds, et quels liens ou quels nœuds
+ *          faut-il couper pour les séparer (théorème de Menger).
+ *
+ * Moteur : Dinic sur un réseau résiduel en tableaux plats, construit une
+ * fois à partir des listes d'adjacence puis réinitialisé entre deux flots.
+ * Toutes les capacités valent 1 (un lien = un chemin) : chaque phase de
+ * Dinic coûte O(E) et il y en a O(√V) pour la connexité en nœuds.
+ *
+ * Comptage des chemins :
+ *   - liens  : chemins sans arc commun ; un lien non orienté compte une fois
+ *   - nœuds  : chemins sans nœud intermédiaire commun ; chaque lien direct
+ *              entre les deux extrémités compte pour un chemin
+ *
+ * @authors Groupe NetFlow - UVCI ALC2101 2025-2026
+ */
+
+#ifndef CONNECTIVITE_H
+#define CONNECTIVITE_H
+
+#include "interfaces.h"
+#include "graphe.h"
+
+/**
+ * @brief Coupe minimale : ce qu'il faut retirer pour séparer deux nœuds
+ */
+typedef struct CoupeMin {
+    int  valeur;    /**< Nombre de chemins disjoints (= taille de la coupe) */
+    int* elements;  /**< Nœuds, ou arcs en paires à plat (src, dest) */
+    int  nb;        /**< Nœuds ou arcs dans elements */
+} CoupeMin;
+
+/** @brief Libère les éléments d'une coupe (la structure reste réutilisable) */
+void liberer_coupe(CoupeMin* coupe);
+
+/* --- Connexité entre deux nœuds --- */
+
+/**
+ * @brief Nombre de chemins s -> t sans lien commun et coupe de liens minimale
+ * @param coupe Remplie si non NULL : arcs à couper, de la partie de s vers
+ *              celle de t (à libérer avec liberer_coupe)
+ * @return λ(s, t), -1 si s ou t invalide ou s == t
+ * @complexity O(E * min(√E, V^(2/3)))
+ */
+int connectivite_aretes(const Graphe* g, int s, int t, CoupeMin* coupe);
+
+/**
+ * @brief Nombre de chemins s -> t sans nœud intermédiaire commun et
+ *        nœuds à retirer pour les séparer
+ * @param coupe Remplie si non NULL : nœuds de la coupe ; si s et t sont
+ *              voisins, il faut en plus couper les liens directs
+ * @return κ(s, t), -1 si s ou t invalide ou s == t
+ * @complexity O(E √V)
+ */
+int connectivite_noeuds(const Graphe* g, int s, int t, CoupeMin* coupe);
+
+/* --- Connexité globale --- */
+
+/**
+ * @brief Plus petit λ(u, v) sur toutes les paires et sa coupe
+ * @details Un nœud fixé contre tous les autres (dans les deux sens si le
+ *          graphe est orienté) ; chaque flot s'arrête dès qu'il atteint le
+ *          meilleur minimum connu.
+ * @return Connexité en liens, 0 si non connexe ou moins de 2 nœuds
+ * @complexity O(V) flots
+ */
+int connectivite_globale_aretes(const Graphe* g, CoupeMin* coupe);
+
+/**
+ * @brief Plus petit κ(u, v) sur les paires non voisines (algorithme d'Even)
+ * @details Seuls les κ + 1 premiers nœuds servent de source ; un graphe
+ *          où toutes les paires sont voisines vaut V - 1 (coupe vide).
+ * @return Connexité en nœuds, 0 si non connexe ou moins de 2 nœuds
+ * @complexity O(κ * V) flots
+ */
+int connectivite_globale_noeuds(const Graphe* g, CoupeMin* coupe);
+
+/* --- Arbre de Gomory-Hu : coupes minimales de toutes les paires --- */
+
+/**
+ * @brief Arbre de coupes (Gomory-Hu, construction de Gusfield)
+ *
+ * V - 1 flots au lieu d'un par paire : λ(u, v) est le plus petit poids
+ * sur le chemin de u à v dans l'arbre, et retirer cette arête de l'arbre
+ * donne une coupe minimale. Défini pour la vue non orientée du réseau
+ * (sur un graphe orienté, chaque arc compte comme un lien).
+ */
+typedef struct ArbreCoupes {
+    int  nb_sommets;   /**< capacite_max du graphe */
+    int  racine;       /**< Premier nœud actif (-1 : graphe vide) */
+    int* parent;       /**< -1 : racine ou nœud inactif */
+    int* poids;        /**< λ(v, parent[v]) */
+    int* profondeur;
+    int  nb_niveaux;
+    int* saut;         /**< saut[k * V + v] : ancêtre à 2^k niveaux */
+    int* saut_min;     /**< Plus petit poids sur ce saut */
+} ArbreCoupes;
+
+/**
+ * @brief Construit l'arbre par V - 1 flots sur le même réseau
+ * @complexity O(V) flots + O(V log V)
+ */
+ArbreCoupes* construire_arbre_coupes(const Graphe* g);
+
+void detruire_arbre_coupes(ArbreCoupes* ac);
+
+/**
+ * @brief λ(u, v) lu dans l'arbre
+ * @return Nombre de chemins sans lien commun, -1 si u ou v invalide ou u == v
+ * @complexity O(log V)
+ */
+int coupe_min_entre(const ArbreCoupes* ac, int u, int v);
+
+/* --- Redondance entre sites --- */
+
+/**
+ * @brief Paires de sites reliées par moins de k chemins disjoints
+ * @param par_noeuds     0 = chemins sans lien commun (arbre de Gomory-Hu si
+ *                       non orienté), 1 = sans nœud intermédiaire commun
+ * @param paires_faibles Paires à plat (au moins nb_sites * (nb_sites - 1)
+ *                       paires, peut être NULL) ; ordonnées si le graphe
+ *                       est orienté
+ * @return Nombre de paires faibles, -1 si paramètres invalides
+ * @complexity un flot arrêté à k par paire ; O(V) flots + O(log V) par
+ *             paire avec l'arbre de Gomory-Hu
+ */
+int verifier_redondance(const Graphe* g, const int* sites, int nb_sites, int k,
+                        int par_noeuds, int* paires_faibles);
+
+#endif /* CONNECTIVITE_H */
@@ -6,36 +6,6 @@
 #include "dijkstra.h"
 #include "utils.h"
 
-/* File de priorite interne */
-typedef struct EntreePQ { int noeud; float distance; struct EntreePQ* suivant; } EntreePQ;
-typedef struct FilePriorite { EntreePQ* tete; int taille; } FilePriorite;
-
-static FilePriorite* pq_creer(void) {
-    FilePriorite* pq = (FilePriorite*)malloc(sizeof(FilePriorite));
-    pq->tete = NULL; pq->taille = 0; return pq;
-}
-static void pq_inserer(FilePriorite* pq, int noeud, float distance) {
-    EntreePQ* e = (EntreePQ*)malloc(sizeof(EntreePQ));
-    e->noeud = noeud; e->distance = distance; e->suivant = NULL;
-    if (!pq->tete || distance < pq->tete->distance) { e->suivant = pq->tete; pq->tete = e; }
-    else {
-        EntreePQ* c = pq->tete;
-        while (c->suivant && c->suivant->distance <= distance) c = c->suivant;
-        e->suivant = c->suivant; c->suivant = e;
-    }
-    pq->taille++;
-}
-static int pq_extraire_min(FilePriorite* pq, float* d) {
-    if (!pq->tete) return -1;
-    EntreePQ* m = pq->tete; int n = m->noeud;
-    if (d) *d = m->distance;
-    pq->tete = m->suivant; free(m); pq->taille--; return n;
-}
-static int pq_vide(const FilePriorite* pq) { return pq->taille == 0; }
-static void pq_detruire(FilePriorite* pq) {
-    EntreePQ* c = pq->tete; while (c) { EntreePQ* t = c->suivant; free(c); c = t; } free(pq);
-}
-
 static Chemin* reconstruire_chemin(int* pred, float* dist, int dest) {
     if (dist[dest] == INFINI) return NULL;
     Chemin* c = creer_chemin();
@@ -48,28 +18,61 @@ static Chemin* reconstruire_chemin(int* pred, float* dist, int dest) {
     return c;
 }
 
-void dijkstra_tout(const Graphe* g, int source, float* dist, int* pred) {
+/* Dijkstra sur la latence en ignorant les aretes de BW < bw_min */
+static void dijkstra_filtre(const Graphe* g, int source, float bw_min,
+                            float* dist, int* pred, const Arete** pred_arete) {
     int V = g->capacite_max;
     for (int i = 0; i < V; i++) { dist[i] = INFINI; pred[i] = -1; }
+    if (pred_arete) for (int i = 0; i < V; i++) pred_arete[i] = NULL;
     dist[source] = 0.0f;
-    FilePriorite* pq = pq_creer();
-    pq_inserer(pq, source, 0.0f);
+    TasMin* pq = creer_tas(V);
+    tas_inserer(pq, source, 0.0f);
     int* traite = (int*)calloc(V, sizeof(int));
-    while (!pq_vide(pq)) {
-        float d_u; int u = pq_extraire_min(pq, &d_u);
+    while (!tas_vide(pq)) {
+        float d_u; int u = tas_extraire_min(pq, &d_u);
         if (traite[u]) continue;
         traite[u] = 1;
         Arete* a = g->noeuds[u].aretes;
         while (a) {
             float nd = dist[u] + a->latence;
-            if (nd < dist[a->destination]) {
+            if (a->bande_passante >= bw_min && nd < dist[a->destination]) {
                 dist[a->destination] = nd; pred[a->destination] = u;
-                pq_inserer(pq, a->destination, nd);
+                if (pred_arete) pred_arete[a->destination] = a;
+                tas_inserer(pq, a->destination, nd);
             }
             a = a->suivant;
         }
     }
-    free(traite); pq_detruire(pq);
+    free(traite); detruire_tas(pq);
+}
+
+void dijkstra_tout(const Graphe* g, int source, float* dist, int* pred) {
+    dijkstra_filtre(g, source, -INFINI, dist, pred, NULL);
+}
+
+void dijkstra_csr(const GrapheCSR* csr, int source, int critere,
+                  float* dist, int* pred) {
+    int V = csr->nb_noeuds;
+    const float* poids = (critere == CRITERE_COUT) ? csr->cout : csr->latence;
+    for (int i = 0; i < V; i++) { dist[i] = INFINI; if (pred) pred[i] = -1; }
+    if (source < 0 || source >= V) return;
+    dist[source] = 0.0f;
+    TasMin* pq = creer_tas(V);
+    tas_inserer(pq, source, 0.0f);
+    while (!tas_vide(pq)) {
+        float d_u; int u = tas_extraire_min(pq, &d_u);
+        if (d_u > dist[u]) continue; /* Entree perimee */
+        for (int e = csr->debut[u]; e < csr->debut[u + 1]; e++) {
+            int v = csr->voisin[e];
+            float nd = d_u + poids[e];
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                if (pred) pred[v] = u;
+                tas_inserer(pq, v, nd);
+            }
+        }
+    }
+    detruire_tas(pq);
 }
 
 Chemin* dijkstra(const Graphe* g, int source, int destination) {
@@ -82,6 +85,91 @@ Chemin* dijkstra(const Graphe* g, int source, int destination) {
     free(dist); free(pred); return c;
 }
 
+/* ============================================================
+ *  DIJKSTRA MULTI-SOURCES (routage anycast)
+ *
+ *  Toutes les sources sont inserees a distance 0 : un seul parcours
+ *  donne, pour chaque noeud, la source la plus proche. Equivaut a un
+ *  Dijkstra depuis une super-source reliee a chaque source par un arc nul.
+ *  Complexite : O((V + E) log V) au lieu de O(S * (V + E) log V)
+ * ============================================================ */
+
+void dijkstra_multi_sources(const Graphe* g, const int* sources, int nb_sources,
+                            float* dist, int* source_proche, int* pred) {
+    int V = g->capacite_max;
+    for (int i = 0; i < V; i++) {
+        dist[i] = INFINI; source_proche[i] = -1;
+        if (pred) pred[i] = -1;
+    }
+    TasMin* pq = creer_tas(V);
+    for (int i = 0; i < nb_sources; i++) {
+        int s = sources[i];
+        if (!noeud_existe(g, s) || dist[s] == 0.0f) continue;
+        dist[s] = 0.0f; source_proche[s] = s;
+        tas_inserer(pq, s, 0.0f);
+    }
+    int* traite = (int*)calloc(V, sizeof(int));
+    while (!tas_vide(pq)) {
+        int u = tas_extraire_min(pq, NULL);
+        if (traite[u]) continue;
+        traite[u] = 1;
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            float nd = dist[u] + a->latence;
+            if (nd < dist[a->destination]) {
+                dist[a->destination] = nd;
+                source_proche[a->destination] = source_proche[u];
+                if (pred) pred[a->destination] = u;
+                tas_inserer(pq, a->destination, nd);
+            }
+        }
+    }
+    free(traite); detruire_tas(pq);
+}
+
+int k_sources_plus_proches(const Graphe* g, int client,
+                           const int* sources, int nb_sources, int k,
+                           int* ids, float* distances) {
+    if (!g || !noeud_existe(g, client) || k <= 0) return 0;
+    int V = g->capacite_max;
+    char* est_source = (char*)calloc(V, sizeof(char));
+    int nb_cibles = 0;
+    for (int i = 0; i < nb_sources; i++) {
+        int s = sources[i];
+        if (noeud_existe(g, s) && !est_source[s]) { est_source[s] = 1; nb_cibles++; }
+    }
+    if (k > nb_cibles) k = nb_cibles;
+
+    float* dist  = (float*)malloc(V * sizeof(float));
+    char* traite = (char*)calloc(V, sizeof(char));
+    for (int i = 0; i < V; i++) dist[i] = INFINI;
+    dist[client] = 0.0f;
+    TasMin* pq = creer_tas(V);
+    tas_inserer(pq, client, 0.0f);
+
+    /* Les sources sont fixees par distance croissante : on s'arrete
+       des que la k-ieme est extraite du tas */
+    int nb = 0;
+    while (nb < k && !tas_vide(pq)) {
+        int u = tas_extraire_min(pq, NULL);
+        if (traite[u]) continue;
+        traite[u] = 1;
+        if (est_source[u]) {
+            ids[nb] = u;
+            if (distances) distances[nb] = dist[u];
+            nb++;
+        }
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            float nd = dist[u] + a->latence;
+            if (nd < dist[a->destination]) {
+                dist[a->destination] = nd;
+                tas_inserer(pq, a->destination, nd);
+            }
+        }
+    }
+    free(est_source); free(dist); free(traite); detruire_tas(pq);
+    return nb;
+}
+
 Chemin* bellman_ford(const Graphe* g, int source, int destination, int* a_cycle_negatif) {
     if (!g || !a_cycle_negatif) return NULL;
     *a_cycle_negatif = 0;
@@ -117,6 +205,261 @@ Chemin* bellman_ford(const Graphe* g, int source, int destination, int* a_cycle_
     free(dist); free(pred); return c;
 }
 
+/* ============================================================
+ *  CHEMIN DE BANDE PASSANTE MAXIMALE (widest path)
+ *
+ *  Phase 1 : Dijkstra "max-min" sur la BW avec une file a seaux.
+ *            Les niveaux sont les valeurs distinctes de BW (quantification
+ *            exacte par rang) : le goulot d'un chemin est toujours l'une
+ *            d'elles, et il ne fait que decroitre le long d'un chemin, donc
+ *            le curseur de seau ne remonte jamais.
+ *  Phase 2 : Dijkstra latence restreint aux aretes de BW >= goulot optimal
+ *            (departage exact, l'ordre lexicographique (bw, latence) n'etant
+ *            pas compatible avec un Dijkstra direct).
+ *
+ *  Complexite : O(E log E) pour les niveaux + O(V + E) pour les seaux
+ * ============================================================ */
+
+static int cmp_float_decroissant(const void* a, const void* b) {
+    float x = *(const float*)a, y = *(const float*)b;
+    return (x < y) - (x > y);
+}
+
+/* Rang d'une BW dans les niveaux tries par ordre decroissant */
+static int niveau_bw(const float* niveaux, int nb, float bw) {
+    int lo = 0, hi = nb - 1;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (niveaux[mid] > bw) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+float bande_passante_max(const Graphe* g, int source, int destination) {
+    if (!g || !noeud_existe(g, source) || !noeud_existe(g, destination)) return 0.0f;
+    if (source == destination) return INFINI;
+    int V = g->capacite_max;
+
+    /* Niveaux de BW distincts, tries du plus large au plus etroit */
+    int nb = 0;
+    for (int u = 0; u < V; u++)
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) nb++;
+    float* niveaux = (float*)malloc((nb + 1) * sizeof(float));
+    nb = 0;
+    for (int u = 0; u < V; u++)
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant)
+            niveaux[nb++] = a->bande_passante;
+    if (nb == 0) { free(niveaux); return 0.0f; }
+    qsort(niveaux, nb, sizeof(float), cmp_float_decroissant);
+    int k = 1;
+    for (int i = 1; i < nb; i++) if (niveaux[i] != niveaux[k - 1]) niveaux[k++] = niveaux[i];
+    nb = k;
+
+    /* Seaux : listes chainees dans un tableau plat (une entree par relachement).
+       Le seau 0 est reserve a la source (goulot infini), le niveau i va au seau i+1. */
+    int capa = nb + 1 + V;
+    int* tete_seau = (int*)malloc((nb + 1) * sizeof(int));
+    int* ent_noeud = (int*)malloc(capa * sizeof(int));
+    int* ent_suiv  = (int*)malloc(capa * sizeof(int));
+    int* meilleur  = (int*)malloc(V * sizeof(int)); /* seau du meilleur goulot connu */
+    int* fige      = (int*)calloc(V, sizeof(int));
+    for (int i = 0; i <= nb; i++) tete_seau[i] = -1;
+    for (int i = 0; i < V; i++) meilleur[i] = nb + 1;
+    int nb_ent = 0;
+
+    meilleur[source] = 0;
+    ent_noeud[0] = source; ent_suiv[0] = -1; tete_seau[0] = 0; nb_ent = 1;
+
+    int resultat = -1;
+    for (int s = 0; s <= nb && resultat < 0; s++) {
+        while (tete_seau[s] != -1) {
+            int e = tete_seau[s];
+            tete_seau[s] = ent_suiv[e];
+            int u = ent_noeud[e];
+            if (fige[u] || meilleur[u] != s) continue;
+            fige[u] = 1;
+            if (u == destination) { resultat = s; break; }
+            for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+                int v = a->destination;
+                if (fige[v]) continue;
+                int sv = niveau_bw(niveaux, nb, a->bande_passante) + 1;
+                if (sv < s) sv = s;  /* goulot = min(goulot(u), bw) */
+                if (sv < meilleur[v]) {
+                    meilleur[v] = sv;
+                    if (nb_ent == capa) {
+                        capa *= 2;
+                        ent_noeud = (int*)realloc(ent_noeud, capa * sizeof(int));
+                        ent_suiv  = (int*)realloc(ent_suiv,  capa * sizeof(int));
+                    }
+                    ent_noeud[nb_ent] = v; ent_suiv[nb_ent] = tete_seau[sv];
+                    tete_seau[sv] = nb_ent++;
+                }
+            }
+        }
+    }
+
+    float bw = (resultat > 0) ? niveaux[resultat - 1] : 0.0f;
+    free(niveaux); free(tete_seau); free(ent_noeud); free(ent_suiv);
+    free(meilleur); free(fige);
+    return bw;
+}
+
+Chemin* chemin_bande_passante_max(const Graphe* g, int source, int destination) {
+    if (!g || !noeud_existe(g, source) || !noeud_existe(g, destination)) return NULL;
+    /* Si la destination est inaccessible, la phase 2 ne la trouvera pas non plus */
+    float goulot = bande_passante_max(g, source, destination);
+
+    int V = g->capacite_max;
+    float* dist = (float*)malloc(V * sizeof(float));
+    int*   pred = (int*)malloc(V * sizeof(int));
+    const Arete** pred_arete = (const Arete**)malloc(V * sizeof(Arete*));
+    dijkstra_filtre(g, source, goulot == INFINI ? -INFINI : goulot, dist, pred, pred_arete);
+    Chemin* c = reconstruire_chemin(pred, dist, destination);
+
+    if (c) {
+        c->bw_minimale = INFINI; c->securite_min = SECURITE_MAX; c->cout_total = 0.0f;
+        for (int n = destination; pred_arete[n]; n = pred[n]) {
+            const Arete* a = pred_arete[n];
+            if (a->bande_passante < c->bw_minimale) c->bw_minimale = a->bande_passante;
+            if (a->securite < c->securite_min) c->securite_min = a->securite;
+            c->cout_total += a->cout;
+        }
+    }
+    free(dist); free(pred); free(pred_arete);
+    return c;
+}
+
+/* ============================================================
+ *  PLUS COURTS CHEMINS A NOMBRE DE SAUTS BORNE
+ *
+ *  Bellman-Ford par couches : dist_h[v] = meilleure latence en au plus
+ *  h sauts. Seules deux lignes de distances sont gardees (h-1 et h).
+ *  Chaque couche est une relaxation "pull" sur le CSR inverse :
+ *    1. cand[e] = prec[origine(e)] + latence[e]  (boucle plate sur les arcs)
+ *    2. cour[v] = min(prec[v], min des cand[e] entrants de v)
+ *  Les deux boucles parcourent des tableaux contigus, sans dependance entre
+ *  iterations : le compilateur peut les vectoriser.
+ *  Les predecesseurs (un arc par couche et par noeud) sont conserves pour
+ *  reconstruire le chemin de chaque couche.
+ *
+ *  Complexite : O(H * (V + E)) en temps, O(H * V) pour les predecesseurs
+ * ============================================================ */
+
+#define SAUT_HERITE (-2) /* dist_h[v] = dist_{h-1}[v] : pas de saut ajoute */
+
+/**
+ * @brief Remplit pred[h * V + v] (arc du CSR inverse, SAUT_HERITE ou -1)
+ *        pour h = 0..h_max
+ * @return Derniere couche calculee (arret anticipe si plus rien ne change)
+ */
+static int bf_couches(const GrapheCSR* inv, int source, int h_max, int* pred) {
+    int V = inv->nb_noeuds, E = inv->nb_arcs;
+    float* prec = (float*)malloc(V * sizeof(float));
+    float* cour = (float*)malloc(V * sizeof(float));
+    float* cand = (float*)malloc((E > 0 ? E : 1) * sizeof(float));
+
+    for (int v = 0; v < V; v++) { prec[v] = INFINI; pred[v] = -1; }
+    prec[source] = 0.0f;
+    pred[source] = SAUT_HERITE;
+
+    int h = 1;
+    for (; h <= h_max; h++) {
+        int* pred_h = pred + (size_t)h * V;
+
+        for (int e = 0; e < E; e++)
+            cand[e] = prec[inv->voisin[e]] + inv->latence[e];
+
+        int modif = 0;
+        for (int v = 0; v < V; v++) {
+            float best = prec[v];
+            int arc = (prec[v] == INFINI) ? -1 : SAUT_HERITE;
+            for (int e = inv->debut[v]; e < inv->debut[v + 1]; e++) {
+                if (cand[e] < best) { best = cand[e]; arc = e; }
+            }
+            cour[v] = best;
+            pred_h[v] = arc;
+            modif |= (arc >= 0);
+        }
+        float* t = prec; prec = cour; cour = t;
+        if (!modif) break;
+    }
+    free(prec); free(cour); free(cand);
+    return h > h_max ? h_max : h;
+}
+
+/* Chemin en au plus h sauts vers v, a partir de la table des predecesseurs */
+static Chemin* chemin_couche(const GrapheCSR* inv, const int* pred, int h, int v) {
+    int V = inv->nb_noeuds;
+    if (pred[(size_t)h * V + v] == -1) return NULL;
+    Chemin* c = creer_chemin();
+    c->bw_minimale = INFINI; c->securite_min = SECURITE_MAX;
+    Pile* p = creer_pile();
+    empiler(p, v);
+    while (h > 0) {
+        int e = pred[(size_t)h * V + v];
+        h--;
+        if (e == SAUT_HERITE) continue;
+        c->latence_totale += inv->latence[e];
+        c->cout_total     += inv->cout[e];
+        if (inv->bande_passante[e] < c->bw_minimale) c->bw_minimale = inv->bande_passante[e];
+        if (inv->securite[e] < c->securite_min) c->securite_min = inv->securite[e];
+        v = inv->voisin[e];
+        empiler(p, v);
+    }
+    while (!pile_vide(p)) ajouter_noeud_chemin(c, depiler(p));
+    detruire_pile(p);
+    return c;
+}
+
+/* Table des predecesseurs pour les couches 0..*h_max. Un plus court chemin
+ * a au plus V - 1 sauts : au-dela, aucune couche ne change, donc *h_max est
+ * ramene a V - 1 avant de dimensionner la table. NULL si l'allocation echoue */
+static int* allouer_couches(int V, int* h_max) {
+    if (*h_max > V - 1) *h_max = V > 0 ? V - 1 : 0;
+    return (int*)malloc(((size_t)*h_max + 1) * (size_t)V * sizeof(int));
+}
+
+Chemin* chemin_sauts_max(const Graphe* g, int source, int destination, int h_max) {
+    if (!g || h_max < 0 || !noeud_existe(g, source) || !noeud_existe(g, destination))
+        return NULL;
+    GrapheCSR* inv = construire_csr(g, 1, NULL);
+    int V = inv->nb_noeuds;
+    int* pred = allouer_couches(V, &h_max);
+    if (!pred) { detruire_csr(inv); return NULL; }
+
+    int derniere = bf_couches(inv, source, h_max, pred);
+    Chemin* c = chemin_couche(inv, pred, derniere, destination);
+
+    free(pred);
+    detruire_csr(inv);
+    return c;
+}
+
+int chemins_par_sauts(const Graphe* g, int source, int destination, int h_max,
+                      Chemin** resultats) {
+    if (!g || h_max < 1 || !resultats) return 0;
+    for (int h = 0; h < h_max; h++) resultats[h] = NULL;
+    if (!noeud_existe(g, source) || !noeud_existe(g, destination)) return 0;
+
+    GrapheCSR* inv = construire_csr(g, 1, NULL);
+    int V = inv->nb_noeuds;
+    int h_calc = h_max;
+    int* pred = allouer_couches(V, &h_calc);
+    if (!pred) { detruire_csr(inv); return 0; }
+
+    int derniere = bf_couches(inv, source, h_calc, pred);
+    int nb = 0;
+    for (int h = 1; h <= h_max; h++) {
+        /* Au-dela de la derniere couche, plus rien ne change */
+        resultats[h - 1] = chemin_couche(inv, pred, h < derniere ? h : derniere, destination);
+        if (resultats[h - 1]) nb++;
+    }
+
+    free(pred);
+    detruire_csr(inv);
+    return nb;
+}
+
 /* Utilitaires chemins */
 Chemin* creer_chemin(void) { return (Chemin*)calloc(1, sizeof(Chemin)); }
 
@@ -14,6 +14,44 @@
 Chemin* dijkstra(const Graphe* g, int source, int destination);
 void    dijkstra_tout(const Graphe* g, int source, float* dist, int* pred);
 
+/* Dijkstra sur une representation CSR (eventuellement filtree ou inversee)
+ * critere = CRITERE_LATENCE ou CRITERE_COUT, pred peut etre NULL.
+ * Sur un CSR inverse, dist[v] = distance de v vers la source. */
+#define CRITERE_LATENCE 0
+#define CRITERE_COUT    1
+void    dijkstra_csr(const GrapheCSR* csr, int source, int critere,
+                     float* dist, int* pred);
+
+/* Dijkstra multi-sources (anycast) - O((V+E) log V) pour toutes les sources
+ * dist[v] = latence depuis la source la plus proche, source_proche[v] = son ID
+ * (-1 si inaccessible). pred peut etre NULL. */
+void    dijkstra_multi_sources(const Graphe* g, const int* sources, int nb_sources,
+                               float* dist, int* source_proche, int* pred);
+
+/* K sources les plus proches d'un client (latence client -> source),
+ * arret des que la k-ieme est fixee. Retourne le nombre trouve (<= k),
+ * ids/distances tries par distance croissante (distances peut etre NULL). */
+int     k_sources_plus_proches(const Graphe* g, int client,
+                               const int* sources, int nb_sources, int k,
+                               int* ids, float* distances);
+
+/* Chemin de bande passante maximale (goulot max, departage sur la latence)
+ * File a seaux sur les niveaux de BW - O(E log E + V + E)
+ * bande_passante_max retourne 0 si la destination est inaccessible */
+float   bande_passante_max(const Graphe* g, int source, int destination);
+Chemin* chemin_bande_passante_max(const Graphe* g, int source, int destination);
+
+/* Plus court chemin (latence) en au plus h_max sauts
+ * Bellman-Ford par couches sur deux lignes de distances - O(H * (V+E)) */
+Chemin* chemin_sauts_max(const Graphe* g, int source, int destination, int h_max);
+
+/* Meilleur chemin pour chaque h = 1..h_max en une seule passe :
+ * resultats[h-1] = chemin en au plus h sauts (NULL si aucun).
+ * resultats est alloue par l'appelant (h_max cases). Retourne le nombre
+ * de chemins trouves. */
+int     chemins_par_sauts(const Graphe* g, int source, int destination, int h_max,
+                          Chemin** resultats);
+
 /* Bellman-Ford - O(V*E) */
 Chemin* bellman_ford(const Graphe* g, int source, int destination,
                      int* a_cycle_negatif);
@@ -0,0 +1,542 @@
+/**
+ * @file etiquettes.c
+ * @brief Implementation du Module Etiquettes (label-setting)
+ *
+ * Algorithmes implementes :
+ *   1. Plus court chemin sous contrainte de ressource (RCSP) par etiquettes,
+ *      dominance de Pareto sur (latence, cout) et bornes par Dijkstra inverse
+ *   2. Front de Pareto (latence, cout, securite) par correction d'etiquettes
+ *      en rondes, expansion et fusion paralleles
+ */
+
+#include "etiquettes.h"
+#include "backtracking.h"
+#include "utils.h"
+
+/* Tolerance sur les bornes : h_cout est une somme flottante calculee dans
+   l'autre sens, elle ne doit pas couper un chemin exactement au budget */
+#define EPS_BORNE 1e-4f
+
+/* ============================================================
+ *  STRUCTURES INTERNES
+ * ============================================================ */
+
+typedef struct Etiquette {
+    float lat;
+    float cout;
+    float bw;        /**< Goulot depuis la source */
+    int   sec;       /**< Securite minimale depuis la source */
+    int   noeud;
+    int   parent;    /**< Indice de l'etiquette precedente, -1 a la source */
+    int   active;    /**< 0 si dominee apres creation */
+} Etiquette;
+
+typedef struct ListeIndices {
+    int* idx;
+    int  nb;
+    int  capa;
+} ListeIndices;
+
+typedef struct ContextEtiquettes {
+    Etiquette*    pool;
+    int           nb;
+    int           capa;
+    ListeIndices* par_noeud;  /**< Etiquettes non dominees de chaque noeud */
+    TasMin*       file;
+    StatsEtiquettes* stats;
+} ContextEtiquettes;
+
+static void liste_ajouter(ListeIndices* l, int i) {
+    if (l->nb == l->capa) {
+        l->capa = l->capa ? 2 * l->capa : 4;
+        l->idx = (int*)realloc(l->idx, l->capa * sizeof(int));
+    }
+    l->idx[l->nb++] = i;
+}
+
+/**
+ * @brief Insere une etiquette au noeud v si elle n'est pas dominee
+ * @return Indice de l'etiquette, -1 si dominee
+ * @complexity O(l) avec l = etiquettes non dominees de v
+ */
+static int inserer_etiquette(ContextEtiquettes* ctx, int v, float lat,
+                             float cout, float bw, int sec, int parent,
+                             float cle) {
+    ListeIndices* l = &ctx->par_noeud[v];
+
+    /* Rejet si une etiquette existante domine (lat <= et cout <=) */
+    for (int i = 0; i < l->nb; i++) {
+        const Etiquette* e = &ctx->pool[l->idx[i]];
+        if (e->lat <= lat && e->cout <= cout) {
+            ctx->stats->etiquettes_dominees++;
+            return -1;
+        }
+    }
+    /* Retrait des etiquettes que la nouvelle domine */
+    for (int i = 0; i < l->nb; ) {
+        Etiquette* e = &ctx->pool[l->idx[i]];
+        if (lat <= e->lat && cout <= e->cout) {
+            e->active = 0;
+            ctx->stats->etiquettes_dominees++;
+            l->idx[i] = l->idx[--l->nb];
+        } else i++;
+    }
+
+    if (ctx->nb == ctx->capa) {
+        ctx->capa *= 2;
+        ctx->pool = (Etiquette*)realloc(ctx->pool, ctx->capa * sizeof(Etiquette));
+    }
+    int id = ctx->nb++;
+    Etiquette* e = &ctx->pool[id];
+    e->lat = lat; e->cout = cout; e->bw = bw; e->sec = sec;
+    e->noeud = v; e->parent = parent; e->active = 1;
+    liste_ajouter(l, id);
+    tas_inserer(ctx->file, id, cle);
+    ctx->stats->etiquettes_creees++;
+    return id;
+}
+
+static Chemin* chemin_depuis_etiquette(const ContextEtiquettes* ctx, int id) {
+    const Etiquette* fin = &ctx->pool[id];
+    Chemin* c = creer_chemin();
+    Pile* p = creer_pile();
+    for (int i = id; i != -1; i = ctx->pool[i].parent)
+        empiler(p, ctx->pool[i].noeud);
+    while (!pile_vide(p)) ajouter_noeud_chemin(c, depiler(p));
+    detruire_pile(p);
+    c->latence_totale = fin->lat;
+    c->cout_total     = fin->cout;
+    c->bw_minimale    = fin->bw;
+    c->securite_min   = fin->sec;
+    return c;
+}
+
+/* ============================================================
+ *  FONCTIONS PUBLIQUES
+ * ============================================================ */
+
+Chemin* chemin_contraint_etiquettes(const Graphe* g, int source,
+                                    int destination,
+                                    const Contraintes* c) {
+    StatsEtiquettes stats;
+    return etiquettes_avec_stats(g, source, destination, c, &stats);
+}
+
+Chemin* etiquettes_avec_stats(const Graphe* g, int source, int destination,
+                              const Contraintes* c, StatsEtiquettes* stats) {
+    StatsEtiquettes local;
+    if (!stats) stats = &local;
+    memset(stats, 0, sizeof(StatsEtiquettes));
+    if (!g || !c || !noeud_existe(g, source) || !noeud_existe(g, destination))
+        return NULL;
+
+    /* Les noeuds obligatoires sortent du cadre (latence, cout) */
+    if (c->nb_obligatoires > 0) {
+        StatsBacktrack sb = {0};
+        Chemin* r = backtracking_avec_stats(g, source, destination, c, NULL, &sb);
+        stats->temps_ms = sb.temps_ms;
+        return r;
+    }
+
+    double t_debut = temps_ms();
+    int V = g->capacite_max;
+
+    /* --- Bornes inferieures par Dijkstra inverse sur le sous-graphe filtre --- */
+    GrapheCSR* avant   = construire_csr(g, 0, c);
+    GrapheCSR* inverse = construire_csr(g, 1, c);
+    float* h_lat  = (float*)malloc(V * sizeof(float));
+    float* h_cout = (float*)malloc(V * sizeof(float));
+    dijkstra_csr(inverse, destination, CRITERE_LATENCE, h_lat, NULL);
+    dijkstra_csr(inverse, destination, CRITERE_COUT,    h_cout, NULL);
+    detruire_csr(inverse);
+
+    float budget = c->cout_max_autorise;
+    Chemin* resultat = NULL;
+
+    if (h_cout[source] <= budget + EPS_BORNE) {
+        ContextEtiquettes ctx;
+        ctx.capa      = V + 16;
+        ctx.nb        = 0;
+        ctx.pool      = (Etiquette*)malloc(ctx.capa * sizeof(Etiquette));
+        ctx.par_noeud = (ListeIndices*)calloc(V, sizeof(ListeIndices));
+        ctx.file      = creer_tas(V);
+        ctx.stats     = stats;
+
+        inserer_etiquette(&ctx, source, 0.0f, 0.0f, INFINI, SECURITE_MAX, -1,
+                          h_lat[source]);
+
+        while (!tas_vide(ctx.file)) {
+            int id = tas_extraire_min(ctx.file, NULL);
+            if (!ctx.pool[id].active) continue;
+            Etiquette e = ctx.pool[id]; /* copie : le pool peut etre realloue */
+            stats->etiquettes_traitees++;
+
+            if (e.noeud == destination) {
+                resultat = chemin_depuis_etiquette(&ctx, id);
+                break;
+            }
+
+            for (int k = avant->debut[e.noeud]; k < avant->debut[e.noeud + 1]; k++) {
+                int v = avant->voisin[k];
+                float nl = e.lat  + avant->latence[k];
+                float nc = e.cout + avant->cout[k];
+
+                /* Borne budget : meme le chemin le moins cher depuis v depasse */
+                if (h_lat[v] == INFINI ||
+                    (v == destination ? nc > budget
+                                      : nc + h_cout[v] > budget + EPS_BORNE)) {
+                    stats->etiquettes_elaguees++;
+                    continue;
+                }
+                float nbw = avant->bande_passante[k] < e.bw ? avant->bande_passante[k] : e.bw;
+                int nsec  = avant->securite[k] < e.sec ? avant->securite[k] : e.sec;
+                inserer_etiquette(&ctx, v, nl, nc, nbw, nsec, id, nl + h_lat[v]);
+            }
+        }
+
+        for (int i = 0; i < V; i++) free(ctx.par_noeud[i].idx);
+        free(ctx.par_noeud);
+        free(ctx.pool);
+        detruire_tas(ctx.file);
+    }
+
+    detruire_csr(avant);
+    free(h_lat);
+    free(h_cout);
+    stats->temps_ms = temps_ms() - t_debut;
+    return resultat;
+}
+
+void afficher_stats_etiquettes(const StatsEtiquettes* stats) {
+    if (!stats) return;
+    printf("\n--- Statistiques Etiquettes ---\n");
+    printf("  Etiquettes creees   : %d\n", stats->etiquettes_creees);
+    printf("  Etiquettes traitees : %d\n", stats->etiquettes_traitees);
+    printf("  Rejets par dominance: %d\n", stats->etiquettes_dominees);
+    printf("  Coupes par bornes   : %d\n", stats->etiquettes_elaguees);
+    printf("  Temps execution     : %.3f ms\n", stats->temps_ms);
+}
+
+/* ============================================================
+ *  FRONT DE PARETO MULTI-OBJECTIF
+ *
+ *  Chaque ronde :
+ *    1. Expansion (parallele) : les etiquettes de la frontiere produisent
+ *       des candidats dans un tampon par thread. Les candidats domines par
+ *       une solution connue a la destination (avec bornes h_lat, h_cout)
+ *       sont coupes tout de suite.
+ *    2. Fusion (parallele) : le thread t traite les candidats des noeuds
+ *       v % T == t, dans l'ordre des tampons -> aucun verrou, resultat
+ *       deterministe. Les indices du pool sont reserves avant la fusion.
+ *    3. Nouvelle frontiere = candidats acceptes encore actifs.
+ * ============================================================ */
+
+#define NB_SEAUX_SEC   (SECURITE_MAX + 1)
+#define SEUIL_PARALLELE 256  /* En dessous, une ronde reste sequentielle */
+
+typedef struct EtiquetteMC {
+    float lat;
+    float cout;
+    float bw;
+    int   sec;
+    int   noeud;
+    int   parent;
+    int   active;
+} EtiquetteMC;
+
+typedef struct TamponCandidats {
+    EtiquetteMC* t;
+    int nb;
+    int capa;
+    int base;        /**< Premier indice reserve dans le pool */
+    int plafond;     /**< Le thread de fusion t a rejete un candidat par plafond */
+} TamponCandidats;
+
+typedef struct ContextPareto {
+    const GrapheCSR* csr;
+    int    destination;
+    float  budget;
+    float  epsilon;
+    int    max_noeud;
+    const float* h_lat;
+    const float* h_cout;
+    EtiquetteMC* pool;
+    ListeIndices* seaux;       /**< seaux[v * NB_SEAUX_SEC + s] */
+    int*   nb_par_noeud;
+    /* Ronde courante */
+    const int* frontiere;
+    int    nb_frontiere;
+    EtiquetteMC* solutions;    /**< Copie des etiquettes de la destination */
+    int    nb_solutions;
+    TamponCandidats* tampons;
+    int    nb_threads;
+} ContextPareto;
+
+typedef struct TachePareto {
+    ContextPareto* ctx;
+    int id;
+} TachePareto;
+
+static int seau_sec(int sec) {
+    return sec < 0 ? 0 : (sec > SECURITE_MAX ? SECURITE_MAX : sec);
+}
+
+/* a domine b (a au moins aussi bon partout), avec tolerance relative eps */
+static int domine_mc(const EtiquetteMC* a, float lat, float cout, int sec, float eps) {
+    return a->sec >= sec &&
+           a->lat  <= lat  * (1.0f + eps) &&
+           a->cout <= cout * (1.0f + eps);
+}
+
+static void* pareto_expansion(void* arg) {
+    TachePareto* tache = (TachePareto*)arg;
+    ContextPareto* ctx = tache->ctx;
+    const GrapheCSR* csr = ctx->csr;
+    TamponCandidats* buf = &ctx->tampons[tache->id];
+    buf->nb = 0;
+
+    int T = ctx->nb_threads;
+    int debut = (int)((long)ctx->nb_frontiere * tache->id / T);
+    int fin   = (int)((long)ctx->nb_frontiere * (tache->id + 1) / T);
+
+    for (int i = debut; i < fin; i++) {
+        int id = ctx->frontiere[i];
+        const EtiquetteMC e = ctx->pool[id];
+        if (!e.active || e.noeud == ctx->destination) continue;
+
+        for (int k = csr->debut[e.noeud]; k < csr->debut[e.noeud + 1]; k++) {
+            int v = csr->voisin[k];
+            if (ctx->h_lat[v] == INFINI) continue;
+            float nl = e.lat  + csr->latence[k];
+            float nc = e.cout + csr->cout[k];
+            int   ns = csr->securite[k] < e.sec ? csr->securite[k] : e.sec;
+            if (v == ctx->destination ? nc > ctx->budget
+                                      : nc + ctx->h_cout[v] > ctx->budget + EPS_BORNE)
+                continue;
+
+            /* Coupe par les solutions deja connues */
+            float bl = nl + ctx->h_lat[v], bc = nc + ctx->h_cout[v];
+            int coupe = 0;
+            for (int j = 0; j < ctx->nb_solutions && !coupe; j++)
+                coupe = domine_mc(&ctx->solutions[j], bl, bc, ns, ctx->epsilon);
+            if (coupe) continue;
+
+            if (buf->nb == buf->capa) {
+                buf->capa = buf->capa ? 2 * buf->capa : 64;
+                buf->t = (EtiquetteMC*)realloc(buf->t, buf->capa * sizeof(EtiquetteMC));
+            }
+            EtiquetteMC* n = &buf->t[buf->nb++];
+            n->lat = nl; n->cout = nc; n->sec = ns; n->noeud = v; n->parent = id;
+            n->bw = csr->bande_passante[k] < e.bw ? csr->bande_passante[k] : e.bw;
+            n->active = 0;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Insere (ou rejette) un candidat dans les seaux de son noeud
+ * @details Rejet : epsilon-dominance par une etiquette de securite >= s.
+ *          Retrait : dominance exacte des etiquettes de securite <= s.
+ */
+static void pareto_fusionner_candidat(ContextPareto* ctx, int id, int* plafond) {
+    EtiquetteMC* n = &ctx->pool[id];
+    int v = n->noeud, s = seau_sec(n->sec);
+    ListeIndices* seaux = &ctx->seaux[v * NB_SEAUX_SEC];
+
+    for (int b = s; b < NB_SEAUX_SEC; b++)
+        for (int i = 0; i < seaux[b].nb; i++)
+            if (domine_mc(&ctx->pool[seaux[b].idx[i]], n->lat, n->cout, n->sec, ctx->epsilon))
+                return;
+
+    for (int b = 0; b <= s; b++) {
+        ListeIndices* l = &seaux[b];
+        for (int i = 0; i < l->nb; ) {
+            EtiquetteMC* e = &ctx->pool[l->idx[i]];
+            if (domine_mc(n, e->lat, e->cout, e->sec, 0.0f)) {
+                e->active = 0;
+                ctx->nb_par_noeud[v]--;
+                l->idx[i] = l->idx[--l->nb];
+            } else i++;
+        }
+    }
+
+    if (ctx->max_noeud > 0 && ctx->nb_par_noeud[v] >= ctx->max_noeud) {
+        *plafond = 1;
+        return;
+    }
+    n->active = 1;
+    ctx->nb_par_noeud[v]++;
+    liste_ajouter(&seaux[s], id);
+}
+
+static void* pareto_fusion(void* arg) {
+    TachePareto* tache = (TachePareto*)arg;
+    ContextPareto* ctx = tache->ctx;
+    int T = ctx->nb_threads;
+    for (int b = 0; b < T; b++) {
+        TamponCandidats* buf = &ctx->tampons[b];
+        for (int j = 0; j < buf->nb; j++) {
+            int id = buf->base + j;
+            if (ctx->pool[id].noeud % T == tache->id)
+                pareto_fusionner_candidat(ctx, id, &ctx->tampons[tache->id].plafond);
+        }
+    }
+    return NULL;
+}
+
+/* Execute fn sur T taches (la tache 0 dans le thread appelant) */
+static void pareto_lancer(ContextPareto* ctx, void* (*fn)(void*), int T) {
+    TachePareto taches[T];
+    for (int t = 0; t < T; t++) { taches[t].ctx = ctx; taches[t].id = t; }
+    executer_en_parallele(fn, taches, sizeof(TachePareto), T);
+}
+
+static int cmp_chemin_latence(const void* a, const void* b) {
+    const Chemin* x = *(Chemin* const*)a;
+    const Chemin* y = *(Chemin* const*)b;
+    if (x->latence_totale != y->latence_totale)
+        return (x->latence_totale > y->latence_totale) - (x->latence_totale < y->latence_totale);
+    return (x->cout_total > y->cout_total) - (x->cout_total < y->cout_total);
+}
+
+Chemin* front_pareto(const Graphe* g, int source, int destination,
+                     const Contraintes* c, const OptionsPareto* opt,
+                     int* nb_chemins, int* tronque) {
+    if (nb_chemins) *nb_chemins = 0;
+    if (tronque) *tronque = 0;
+    if (!g || !noeud_existe(g, source) || !noeud_existe(g, destination)) return NULL;
+
+    OptionsPareto defaut = {0, 0, 0.0f, 0};
+    if (!opt) opt = &defaut;
+    int V = g->capacite_max;
+    int T_max = opt->nb_threads > 0 ? opt->nb_threads : nb_threads_disponibles();
+
+    GrapheCSR* avant   = construire_csr(g, 0, c);
+    GrapheCSR* inverse = construire_csr(g, 1, c);
+    float* h_lat  = (float*)malloc(V * sizeof(float));
+    float* h_cout = (float*)malloc(V * sizeof(float));
+    dijkstra_csr(inverse, destination, CRITERE_LATENCE, h_lat, NULL);
+    dijkstra_csr(inverse, destination, CRITERE_COUT,    h_cout, NULL);
+    detruire_csr(inverse);
+
+    ContextPareto ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.csr         = avant;
+    ctx.destination = destination;
+    ctx.budget      = c ? c->cout_max_autorise : INFINI;
+    ctx.epsilon     = opt->epsilon > 0.0f ? opt->epsilon : 0.0f;
+    ctx.max_noeud   = opt->max_etiquettes_noeud;
+    ctx.h_lat       = h_lat;
+    ctx.h_cout      = h_cout;
+    ctx.seaux        = (ListeIndices*)calloc((size_t)V * NB_SEAUX_SEC, sizeof(ListeIndices));
+    ctx.nb_par_noeud = (int*)calloc(V, sizeof(int));
+    ctx.tampons      = (TamponCandidats*)calloc(T_max, sizeof(TamponCandidats));
+
+    int capa_pool = V + 16, nb_pool = 1;
+    ctx.pool = (EtiquetteMC*)malloc(capa_pool * sizeof(EtiquetteMC));
+    EtiquetteMC* src = &ctx.pool[0];
+    src->lat = 0.0f; src->cout = 0.0f; src->bw = INFINI; src->sec = SECURITE_MAX;
+    src->noeud = source; src->parent = -1; src->active = 1;
+    liste_ajouter(&ctx.seaux[source * NB_SEAUX_SEC + SECURITE_MAX], 0);
+    ctx.nb_par_noeud[source] = 1;
+
+    int* frontiere = (int*)malloc(sizeof(int));
+    int nb_frontiere = 1;
+    frontiere[0] = 0;
+    int capa_sol = 0;
+    int coupe = 0;
+
+    if (h_lat[source] == INFINI || (source != destination && h_cout[source] > ctx.budget + EPS_BORNE))
+        nb_frontiere = 0;
+
+    while (nb_frontiere > 0) {
+        /* Instantane des solutions pour l'elagage de la ronde */
+        ctx.nb_solutions = 0;
+        for (int b = 0; b < NB_SEAUX_SEC; b++) {
+            ListeIndices* l = &ctx.seaux[destination * NB_SEAUX_SEC + b];
+            for (int i = 0; i < l->nb; i++) {
+                if (ctx.nb_solutions == capa_sol) {
+                    capa_sol = capa_sol ? 2 * capa_sol : 16;
+                    ctx.solutions = (EtiquetteMC*)realloc(ctx.solutions, capa_sol * sizeof(EtiquetteMC));
+                }
+                ctx.solutions[ctx.nb_solutions++] = ctx.pool[l->idx[i]];
+            }
+        }
+
+        /* 1. Expansion */
+        ctx.frontiere    = frontiere;
+        ctx.nb_frontiere = nb_frontiere;
+        ctx.nb_threads   = nb_frontiere >= SEUIL_PARALLELE ? T_max : 1;
+        pareto_lancer(&ctx, pareto_expansion, ctx.nb_threads);
+
+        /* Reservation des indices du pool */
+        int total = 0;
+        for (int t = 0; t < ctx.nb_threads; t++) total += ctx.tampons[t].nb;
+        if (opt->max_etiquettes_total > 0 && nb_pool + total > opt->max_etiquettes_total) {
+            coupe = 1;
+            break;
+        }
+        if (nb_pool + total > capa_pool) {
+            while (nb_pool + total > capa_pool) capa_pool *= 2;
+            ctx.pool = (EtiquetteMC*)realloc(ctx.pool, capa_pool * sizeof(EtiquetteMC));
+        }
+        for (int t = 0; t < ctx.nb_threads; t++) {
+            TamponCandidats* buf = &ctx.tampons[t];
+            buf->base = nb_pool;
+            memcpy(&ctx.pool[nb_pool], buf->t, buf->nb * sizeof(EtiquetteMC));
+            nb_pool += buf->nb;
+        }
+
+        /* 2. Fusion */
+        pareto_lancer(&ctx, pareto_fusion, ctx.nb_threads);
+
+        /* 3. Nouvelle frontiere */
+        frontiere = (int*)realloc(frontiere, (total > 0 ? total : 1) * sizeof(int));
+        nb_frontiere = 0;
+        for (int id = nb_pool - total; id < nb_pool; id++)
+            if (ctx.pool[id].active && ctx.pool[id].noeud != destination)
+                frontiere[nb_frontiere++] = id;
+    }
+
+    /* Construction des chemins a partir des etiquettes de la destination */
+    int nb = 0;
+    Chemin** tab = NULL;
+    for (int b = 0; b < NB_SEAUX_SEC; b++) {
+        ListeIndices* l = &ctx.seaux[destination * NB_SEAUX_SEC + b];
+        if (l->nb == 0) continue;
+        tab = (Chemin**)realloc(tab, (nb + l->nb) * sizeof(Chemin*));
+        for (int i = 0; i < l->nb; i++) {
+            const EtiquetteMC* e = &ctx.pool[l->idx[i]];
+            Chemin* ch = creer_chemin();
+            Pile* p = creer_pile();
+            for (int j = l->idx[i]; j != -1; j = ctx.pool[j].parent)
+                empiler(p, ctx.pool[j].noeud);
+            while (!pile_vide(p)) ajouter_noeud_chemin(ch, depiler(p));
+            detruire_pile(p);
+            ch->latence_totale = e->lat;
+            ch->cout_total     = e->cout;
+            ch->bw_minimale    = e->bw;
+            ch->securite_min   = e->sec;
+            tab[nb++] = ch;
+        }
+    }
+    Chemin* tete = NULL;
+    if (nb > 0) {
+        qsort(tab, nb, sizeof(Chemin*), cmp_chemin_latence);
+        for (int i = nb - 1; i >= 0; i--) { tab[i]->suivant = tete; tete = tab[i]; }
+    }
+    free(tab);
+
+    if (nb_chemins) *nb_chemins = nb;
+    for (int t = 0; t < T_max; t++) coupe |= ctx.tampons[t].plafond;
+    if (tronque) *tronque = coupe;
+
+    for (int i = 0; i < V * NB_SEAUX_SEC; i++) free(ctx.seaux[i].idx);
+    for (int t = 0; t < T_max; t++) free(ctx.tampons[t].t);
+    free(ctx.seaux); free(ctx.nb_par_noeud); free(ctx.tampons);
+    free(ctx.pool); free(ctx.solutions); free(frontiere);
+    free(h_lat); free(h_cout);
+    detruire_csr(avant);
+    return tete;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file etiquettes.h
+ * @brief Module Etiquettes - Routage contraint par etiquettes (label-setting)
+ * @details Alternative polynomiale en pratique au backtracking pour les
+ *          requetes avec budget : chaque noeud porte un ensemble d'etiquettes
+ *          (latence, cout) mutuellement non dominees, et l'exploration suit
+ *          la latence + une borne inferieure issue d'un Dijkstra inverse.
+ *
+ * Complexite : O(L log L + L * l) ou L = etiquettes creees et l = etiquettes
+ *              non dominees par noeud ; L reste tres loin de O(b^d) car les
+ *              etats domines et les etats hors budget sont coupes des la creation.
+ *
+ * @authors Groupe NetFlow - UVCI ALC2101 2025-2026
+ */
+
+#ifndef ETIQUETTES_H
+#define ETIQUETTES_H
+
+#include "interfaces.h"
+#include "graphe.h"
+#include "dijkstra.h"
+
+/* ============================================================
+ *  PLUS COURT CHEMIN SOUS CONTRAINTE DE RESSOURCE (RCSP)
+ * ============================================================ */
+
+/**
+ * @brief Statistiques du moteur a etiquettes
+ */
+typedef struct StatsEtiquettes {
+    int etiquettes_creees;    /**< Etiquettes inserees dans la file */
+    int etiquettes_traitees;  /**< Etiquettes extraites et etendues */
+    int etiquettes_dominees;  /**< Rejetees ou retirees par dominance */
+    int etiquettes_elaguees;  /**< Coupees par les bornes (budget, latence) */
+    double temps_ms;          /**< Temps d'execution en millisecondes */
+} StatsEtiquettes;
+
+/**
+ * @brief Chemin de latence minimale avec cout total <= cout_max_autorise
+ *
+ * Memes filtres que chemin_contraint_backtracking : bw_min_requise et
+ * securite_min sur chaque arete, noeuds_exclus evites. Les noeuds
+ * obligatoires ne sont pas geres par ce moteur : si nb_obligatoires > 0,
+ * la requete est deleguee au backtracking.
+ *
+ * Etapes :
+ *   1. Dijkstra inverse depuis la destination sur la latence et sur le cout
+ *      (sous-graphe filtre) : bornes inferieures h_lat(v) et h_cout(v)
+ *   2. Etiquette (lat, cout) creee seulement si cout + h_cout(v) <= budget
+ *      et si aucune etiquette de v ne la domine
+ *   3. Extraction par lat + h_lat croissant : la premiere etiquette extraite
+ *      a la destination est optimale (h_lat est coherente)
+ *
+ * @return Meilleur chemin (latence, cout, bw, securite renseignes), NULL sinon
+ */
+Chemin* chemin_contraint_etiquettes(const Graphe* g, int source,
+                                    int destination,
+                                    const Contraintes* c);
+
+/**
+ * @brief Version avec statistiques
+ */
+Chemin* etiquettes_avec_stats(const Graphe* g, int source, int destination,
+                              const Contraintes* c, StatsEtiquettes* stats);
+
+void afficher_stats_etiquettes(const StatsEtiquettes* stats);
+
+/* ============================================================
+ *  FRONT DE PARETO MULTI-OBJECTIF (latence, cout, securite)
+ * ============================================================ */
+
+/**
+ * @brief Reglages du moteur multi-objectif (NULL = valeurs par defaut)
+ */
+typedef struct OptionsPareto {
+    int   max_etiquettes_noeud;  /**< Plafond d'etiquettes par noeud (0 = aucun) */
+    int   max_etiquettes_total;  /**< Plafond global (0 = aucun) */
+    float epsilon;               /**< 0 = dominance exacte, > 0 = epsilon-dominance
+                                      relative sur latence et cout */
+    int   nb_threads;            /**< 0 = nombre de coeurs */
+} OptionsPareto;
+
+/**
+ * @brief Tous les chemins non domines entre deux noeuds
+ *
+ * Objectifs : latence min, cout min, securite_min max. Un chemin est garde
+ * si aucun autre n'est au moins aussi bon sur les trois criteres.
+ *
+ * Moteur par correction d'etiquettes en rondes :
+ *   - expansion parallele de la frontiere (tampons par thread)
+ *   - fusion parallele : chaque thread possede les noeuds v % T == t
+ *   - etiquettes de chaque noeud rangees en seaux par niveau de securite,
+ *     un test de dominance ne parcourt que les seaux de securite >= s
+ *   - coupe des etiquettes dominees par une solution deja connue
+ *     (bornes h_lat, h_cout par Dijkstra inverse)
+ *
+ * Avec epsilon > 0 ou des plafonds, le resultat est une approximation
+ * du front (signalee par *tronque = 1 si un plafond a ete atteint).
+ *
+ * @param c          Filtres bw / securite / exclusions et budget (peut etre NULL)
+ * @param nb_chemins Nombre de chemins retournes (peut etre NULL)
+ * @param tronque    1 si un plafond a coupe la recherche (peut etre NULL)
+ * @return Liste chainee (champ suivant) triee par latence croissante
+ * @complexity O(R * F * d) avec R rondes, F etiquettes de frontiere
+ */
+Chemin* front_pareto(const Graphe* g, int source, int destination,
+                     const Contraintes* c, const OptionsPareto* opt,
+                     int* nb_chemins, int* tronque);
+
+#endif /* ETIQUETTES_H */
@@ -124,11 +124,10 @@ int noeud_existe(const Graphe* g, int id) {
  *  MANIPULATION DES ARÊTES
  * ============================================================ */
 
-int ajouter_arete(Graphe* g, int src, int dest,
-                  float latence, float bande_passante,
-                  float cout, int securite) {
-    if (!g || !noeud_existe(g, src) || !noeud_existe(g, dest)) return -1;
-
+/* Insere un arc src -> dest (liste + matrices), sans l'arc inverse */
+static int inserer_arc(Graphe* g, int src, int dest,
+                       float latence, float bande_passante,
+                       float cout, int securite) {
     /* --- Liste d'adjacence --- */
     Arete* nouvelle = (Arete*)malloc(sizeof(Arete));
     if (!nouvelle) return -1;
@@ -147,15 +146,26 @@ int ajouter_arete(Graphe* g, int src, int dest,
     g->matrice_cout[src][dest]    = cout;
     g->matrice_sec[src][dest]     = securite;
 
-    /* Si non orienté, ajouter l'arête inverse */
-    if (!g->est_oriente) {
-        ajouter_arete(g, dest, src, latence, bande_passante, cout, securite);
-    }
-
     g->nb_aretes++;
     return 0;
 }
 
+int ajouter_arete(Graphe* g, int src, int dest,
+                  float latence, float bande_passante,
+                  float cout, int securite) {
+    if (!g || !noeud_existe(g, src) || !noeud_existe(g, dest)) return -1;
+
+    if (inserer_arc(g, src, dest, latence, bande_passante, cout, securite) != 0)
+        return -1;
+
+    /* Si non orienté, ajouter l'arête inverse (une seule fois) */
+    if (!g->est_oriente && src != dest) {
+        if (inserer_arc(g, dest, src, latence, bande_passante, cout, securite) != 0)
+            return -1;
+    }
+    return 0;
+}
+
 int supprimer_arete(Graphe* g, int src, int dest) {
     if (!g || !noeud_existe(g, src)) return -1;
 
@@ -187,6 +197,277 @@ Arete* trouver_arete(const Graphe* g, int src, int dest) {
     return NULL;
 }
 
+int trouver_noeuds_prefixe(const Graphe* g, const char* prefixe, int* ids) {
+    if (!g || !prefixe) return 0;
+    size_t lg = strlen(prefixe);
+    int nb = 0;
+    for (int i = 0; i < g->capacite_max; i++) {
+        if (g->noeuds[i].actif && strncmp(g->noeuds[i].nom, prefixe, lg) == 0)
+            ids[nb++] = i;
+    }
+    return nb;
+}
+
+/* ============================================================
+ *  REPRÉSENTATION COMPACTE (CSR)
+ * ============================================================ */
+
+static int arc_conserve(const Arete* a, const Contraintes* c, const char* exclu) {
+    if (!c) return 1;
+    return a->bande_passante >= c->bw_min_requise &&
+           a->securite       >= c->securite_min   &&
+           !exclu[a->destination];
+}
+
+GrapheCSR* construire_csr(const Graphe* g, int inverse, const Contraintes* c) {
+    if (!g) return NULL;
+    int V = g->capacite_max;
+    GrapheCSR* csr = (GrapheCSR*)calloc(1, sizeof(GrapheCSR));
+    if (!csr) return NULL;
+    csr->nb_noeuds   = V;
+    csr->est_inverse = inverse;
+    csr->debut = (int*)calloc(V + 1, sizeof(int));
+
+    char* exclu = (char*)calloc(V, sizeof(char));
+    if (c) {
+        for (int i = 0; i < c->nb_exclus; i++) {
+            int x = c->noeuds_exclus[i];
+            if (x >= 0 && x < V) exclu[x] = 1;
+        }
+    }
+
+    /* Passe 1 : degrés (sortants ou entrants) */
+    for (int u = 0; u < V; u++) {
+        if (!g->noeuds[u].actif) continue;
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            if (!arc_conserve(a, c, exclu)) continue;
+            csr->debut[(inverse ? a->destination : u) + 1]++;
+            csr->nb_arcs++;
+        }
+    }
+    for (int u = 0; u < V; u++) csr->debut[u + 1] += csr->debut[u];
+
+    int E = csr->nb_arcs > 0 ? csr->nb_arcs : 1;
+    csr->voisin         = (int*)  malloc(E * sizeof(int));
+    csr->latence        = (float*)malloc(E * sizeof(float));
+    csr->bande_passante = (float*)malloc(E * sizeof(float));
+    csr->cout           = (float*)malloc(E * sizeof(float));
+    csr->securite       = (int*)  malloc(E * sizeof(int));
+
+    /* Passe 2 : remplissage dans l'ordre des listes d'adjacence */
+    int* pos = (int*)malloc(V * sizeof(int));
+    memcpy(pos, csr->debut, V * sizeof(int));
+    for (int u = 0; u < V; u++) {
+        if (!g->noeuds[u].actif) continue;
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            if (!arc_conserve(a, c, exclu)) continue;
+            int e = inverse ? pos[a->destination]++ : pos[u]++;
+            csr->voisin[e]         = inverse ? u : a->destination;
+            csr->latence[e]        = a->latence;
+            csr->bande_passante[e] = a->bande_passante;
+            csr->cout[e]           = a->cout;
+            csr->securite[e]       = a->securite;
+        }
+    }
+    free(pos);
+    free(exclu);
+    return csr;
+}
+
+void detruire_csr(GrapheCSR* csr) {
+    if (!csr) return;
+    free(csr->debut);
+    free(csr->voisin);
+    free(csr->latence);
+    free(csr->bande_passante);
+    free(csr->cout);
+    free(csr->securite);
+    free(csr);
+}
+
+void marquer_accessibles_csr(const GrapheCSR* csr, int source, char* marque) {
+    if (!csr || source < 0 || source >= csr->nb_noeuds || marque[source]) return;
+    int* file = (int*)malloc(csr->nb_noeuds * sizeof(int));
+    int tete = 0, queue = 0;
+    marque[source] = 1;
+    file[queue++] = source;
+    while (tete < queue) {
+        int u = file[tete++];
+        for (int e = csr->debut[u]; e < csr->debut[u + 1]; e++) {
+            int v = csr->voisin[e];
+            if (!marque[v]) { marque[v] = 1; file[queue++] = v; }
+        }
+    }
+    free(file);
+}
+
+void restreindre_csr(GrapheCSR* csr, const char* garde) {
+    if (!csr) return;
+    int k = 0;
+    for (int u = 0; u < csr->nb_noeuds; u++) {
+        int deb = csr->debut[u], fin = csr->debut[u + 1];
+        csr->debut[u] = k;
+        if (!garde[u]) continue;
+        for (int e = deb; e < fin; e++) {
+            if (!garde[csr->voisin[e]]) continue;
+            csr->voisin[k]         = csr->voisin[e];
+            csr->latence[k]        = csr->latence[e];
+            csr->bande_passante[k] = csr->bande_passante[e];
+            csr->cout[k]           = csr->cout[e];
+            csr->securite[k]       = csr->securite[e];
+            k++;
+        }
+    }
+    csr->debut[csr->nb_noeuds] = k;
+    csr->nb_arcs = k;
+}
+
+/* ============================================================
+ *  PARCOURS EN LARGEUR À DIRECTION OPTIMISÉE (Beamer)
+ *  - descendant : chaque nœud de la frontière examine ses arcs sortants
+ *  - montant    : chaque nœud non visité cherche un prédécesseur dans la
+ *                 frontière (arcs entrants) et s'arrête au premier trouvé
+ *  Bascule en montant quand les arcs de la frontière (m_f) dépassent
+ *  ceux des nœuds non visités (m_u) / BFS_ALPHA, retour en descendant
+ *  quand la frontière passe sous V / BFS_BETA nœuds (seuil aussi exigé
+ *  pour monter, sinon les petites frontières de fin de parcours
+ *  alterneraient entre les deux modes).
+ *  Frontière en tableau plat, visités en bitset ; les grandes étapes
+ *  sont réparties entre threads (tampons locaux concaténés ensuite).
+ * ============================================================ */
+
+#define BFS_ALPHA            14
+#define BFS_BETA             24
+#define BFS_SEUIL_PARALLELE  4096  /* Nœuds à traiter pour lancer des threads */
+
+typedef struct EtapeBFS {
+    const GrapheCSR* avant;
+    const GrapheCSR* arriere;
+    uint64_t*        visite;
+    const uint64_t*  front;       /**< Frontière en bitset (étape montante) */
+    const int*       frontiere;   /**< Frontière en tableau (étape descendante) */
+    int              debut, fin;  /**< Indices de frontière ou plage de nœuds */
+    int              partage;     /**< 1 : bitset visite modifié par plusieurs threads */
+    int*             suivants;    /**< Nœuds découverts (tampon local, V cases) */
+    int              nb;
+    long             arcs;        /**< Degrés sortants cumulés des nœuds découverts */
+} EtapeBFS;
+
+static int degre_csr(const GrapheCSR* csr, int u) {
+    return csr->debut[u + 1] - csr->debut[u];
+}
+
+static void* etape_descendante(void* arg) {
+    EtapeBFS* t = (EtapeBFS*)arg;
+    const GrapheCSR* a = t->avant;
+    for (int i = t->debut; i < t->fin; i++) {
+        int u = t->frontiere[i];
+        for (int e = a->debut[u]; e < a->debut[u + 1]; e++) {
+            int v = a->voisin[e];
+            uint64_t bit = UINT64_C(1) << (v & 63);
+            uint64_t* mot = &t->visite[v >> 6];
+            if (t->partage) {
+                /* Lecture puis réservation atomique : un seul thread garde v */
+                if (__atomic_load_n(mot, __ATOMIC_RELAXED) & bit) continue;
+                if (__atomic_fetch_or(mot, bit, __ATOMIC_RELAXED) & bit) continue;
+            } else {
+                if (*mot & bit) continue;
+                *mot |= bit;
+            }
+            t->suivants[t->nb++] = v;
+            t->arcs += degre_csr(a, v);
+        }
+    }
+    return NULL;
+}
+
+static void* etape_montante(void* arg) {
+    EtapeBFS* t = (EtapeBFS*)arg;
+    const GrapheCSR* r = t->arriere;
+    /* Plage alignée sur 64 : chaque thread écrit ses propres mots de visite */
+    for (int v = t->debut; v < t->fin; v++) {
+        if (BITSET_TEST(t->visite, v)) continue;
+        for (int e = r->debut[v]; e < r->debut[v + 1]; e++) {
+            if (!BITSET_TEST(t->front, r->voisin[e])) continue;
+            BITSET_AJOUTER(t->visite, v);
+            t->suivants[t->nb++] = v;
+            t->arcs += degre_csr(t->avant, v);
+            break;
+        }
+    }
+    return NULL;
+}
+
+static void lancer_etape(EtapeBFS* t, int W, void* (*fn)(void*)) {
+    executer_en_parallele(fn, t, sizeof(EtapeBFS), W);
+}
+
+int parcours_largeur(const Graphe* g, int depart, int* ordre, int nb_threads) {
+    if (!g || !noeud_existe(g, depart)) return 0;
+    int V = g->capacite_max;
+    GrapheCSR* avant   = construire_csr(g, 0, NULL);
+    GrapheCSR* arriere = g->est_oriente ? NULL : avant; /* Non orienté : symétrique */
+    int W_max = nb_threads > 0 ? nb_threads : nb_threads_disponibles();
+    if (W_max > 64) W_max = 64;
+
+    uint64_t* visite = creer_bitset(V);
+    uint64_t* front  = creer_bitset(V);
+    int*  frontiere  = (int*)malloc(V * sizeof(int));
+    int** tampons    = (int**)calloc(W_max, sizeof(int*));
+    EtapeBFS etapes[64];
+
+    BITSET_AJOUTER(visite, depart);
+    frontiere[0] = depart;
+    if (ordre) ordre[0] = depart;
+    int  nb_visites = 1, n_f = 1, montant = 0;
+    long m_f = degre_csr(avant, depart);
+    long m_u = avant->nb_arcs - m_f;
+
+    while (n_f > 0) {
+        if (!montant && m_f > m_u / BFS_ALPHA && n_f >= V / BFS_BETA) montant = 1;
+        else if (montant && n_f < V / BFS_BETA) montant = 0;
+        if (montant && !arriere) arriere = construire_csr(g, 1, NULL);
+
+        /* Répartition : frontière (descendant) ou nœuds par blocs de 64 (montant) */
+        int travail = montant ? V : n_f;
+        int W = (W_max > 1 && travail >= BFS_SEUIL_PARALLELE) ? W_max : 1;
+        int part = (travail + W - 1) / W;
+        if (montant) part = (part + 63) & ~63;
+        if (montant) {
+            memset(front, 0, BITSET_MOTS(V) * sizeof(uint64_t));
+            for (int i = 0; i < n_f; i++) BITSET_AJOUTER(front, frontiere[i]);
+        }
+        for (int i = 0; i < W; i++) {
+            if (!tampons[i]) tampons[i] = (int*)malloc(V * sizeof(int));
+            EtapeBFS* t = &etapes[i];
+            t->avant = avant; t->arriere = arriere;
+            t->visite = visite; t->front = front; t->frontiere = frontiere;
+            t->debut = i * part < travail ? i * part : travail;
+            t->fin   = t->debut + part < travail ? t->debut + part : travail;
+            t->partage = (W > 1);
+            t->suivants = tampons[i]; t->nb = 0; t->arcs = 0;
+        }
+        lancer_etape(etapes, W, montant ? etape_montante : etape_descendante);
+
+        /* Nouvelle frontière : concaténation des tampons dans l'ordre des threads */
+        n_f = 0; m_f = 0;
+        for (int i = 0; i < W; i++) {
+            memcpy(frontiere + n_f, etapes[i].suivants, etapes[i].nb * sizeof(int));
+            n_f += etapes[i].nb;
+            m_f += etapes[i].arcs;
+        }
+        if (ordre) memcpy(ordre + nb_visites, frontiere, n_f * sizeof(int));
+        nb_visites += n_f;
+        m_u -= m_f;
+    }
+
+    for (int i = 0; i < W_max; i++) free(tampons[i]);
+    free(tampons); free(frontiere); free(visite); free(front);
+    if (arriere != avant) detruire_csr(arriere);
+    detruire_csr(avant);
+    return nb_visites;
+}
+
 /* ============================================================
  *  CHARGEMENT / SAUVEGARDE
  * ============================================================ */
@@ -279,36 +560,29 @@ void afficher_graphe(const Graphe* g) {
 }
 
 int graphe_est_connexe(const Graphe* g) {
-    /* Utilise un BFS depuis le premier nœud actif */
+    /* BFS simple depuis le premier nœud actif, sur les listes d'adjacence :
+       pas de copie CSR ni de threads pour une réponse oui / non */
     if (!g || g->nb_noeuds == 0) return 1;
-    int* visite = (int*)calloc(g->capacite_max, sizeof(int));
-    if (!visite) return 0;
-
-    /* Trouver le premier nœud actif */
+    int V = g->capacite_max;
     int depart = -1;
-    for (int i = 0; i < g->capacite_max; i++) {
+    for (int i = 0; i < V; i++) {
         if (g->noeuds[i].actif) { depart = i; break; }
     }
-
-    /* BFS simple */
-    FileSimple* file = creer_file_simple(); /* déclarée dans utils.c */
-    enfiler_simple(file, depart);
-    visite[depart] = 1;
-    int nb_visites = 1;
-
-    while (!file_simple_vide(file)) {
-        int u = defiler_simple(file);
-        Arete* a = g->noeuds[u].aretes;
-        while (a) {
-            if (!visite[a->destination]) {
-                visite[a->destination] = 1;
-                enfiler_simple(file, a->destination);
-                nb_visites++;
-            }
-            a = a->suivant;
+    uint64_t* visite = creer_bitset(V);
+    int* file = (int*)malloc(V * sizeof(int));
+    if (!visite || !file) { free(visite); free(file); return 0; }
+    int tete = 0, queue = 0;
+    BITSET_AJOUTER(visite, depart);
+    file[queue++] = depart;
+    while (tete < queue) {
+        int u = file[tete++];
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            int v = a->destination;
+            if (!noeud_existe(g, v) || BITSET_TEST(visite, v)) continue;
+            BITSET_AJOUTER(visite, v);
+            file[queue++] = v;
         }
     }
-    detruire_file_simple(file);
-    free(visite);
-    return (nb_visites == g->nb_noeuds);
+    free(visite); free(file);
+    return queue == g->nb_noeuds;
 }
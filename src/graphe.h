@@ -79,4 +79,66 @@ int  graphe_est_connexe(const Graphe* g);
 int  noeud_existe(const Graphe* g, int id);
 Arete* trouver_arete(const Graphe* g, int src, int dest);
 
+/**
+ * @brief Collecte les nœuds actifs dont le nom commence par un préfixe
+ * @details Ex : prefixe "Serveur_" pour sélectionner tous les serveurs
+ * @param ids Tableau de sortie (au moins capacite_max cases)
+ * @return Nombre de nœuds trouvés
+ * @complexity O(V)
+ */
+int trouver_noeuds_prefixe(const Graphe* g, const char* prefixe, int* ids);
+
+/* --- Représentation compacte (CSR) --- */
+
+/**
+ * @brief Construit une copie CSR du graphe, éventuellement filtrée
+ * @param inverse 1 = arcs entrants (pour les parcours depuis la destination)
+ * @param c       Contraintes à appliquer (NULL = aucun filtre) : un arc u->v
+ *                est conservé si bw >= bw_min_requise, securite >= securite_min
+ *                et v n'est pas exclu
+ * @return CSR alloué, NULL si échec
+ * @complexity O(V + E)
+ */
+GrapheCSR* construire_csr(const Graphe* g, int inverse, const Contraintes* c);
+
+/**
+ * @brief Libère un CSR
+ * @complexity O(1)
+ */
+void detruire_csr(GrapheCSR* csr);
+
+/**
+ * @brief Marque les nœuds atteignables depuis source en suivant les arcs du CSR
+ *        (sur un CSR inverse : les nœuds depuis lesquels source est atteignable)
+ * @param marque Tableau de nb_noeuds cases, mis à 1 pour chaque nœud atteint
+ *               (les cases déjà à 1 ne sont pas re-parcourues)
+ * @complexity O(V + E)
+ */
+void marquer_accessibles_csr(const GrapheCSR* csr, int source, char* marque);
+
+/**
+ * @brief Restreint un CSR, en place, aux arcs dont les deux extrémités sont gardées
+ * @param garde garde[v] != 0 si le nœud v est conservé
+ * @complexity O(V + E)
+ */
+void restreindre_csr(GrapheCSR* csr, const char* garde);
+
+/* --- Parcours en largeur --- */
+
+/**
+ * @brief BFS à direction optimisée depuis depart (Beamer)
+ *
+ * Frontière en tableau plat et visités en bitset sur une copie CSR ;
+ * étapes descendantes (arcs sortants de la frontière) ou montantes (chaque
+ * nœud non visité cherche un prédécesseur dans la frontière) selon la
+ * taille de la frontière. Les grandes étapes sont réparties entre threads.
+ *
+ * @param ordre      Nœuds atteints, niveau par niveau (V cases, peut être NULL) ;
+ *                   en séquentiel et en descendant, même ordre qu'une file FIFO
+ * @param nb_threads Threads pour les grandes frontières (0 = nombre de coeurs)
+ * @return Nombre de nœuds atteints (depart compris), 0 si depart invalide
+ * @complexity O(V + E)
+ */
+int parcours_largeur(const Graphe* g, int depart, int* ordre, int nb_threads);
+
 #endif /* GRAPHE_H */
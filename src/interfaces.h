@@ -69,6 +69,24 @@ typedef struct Graphe {
     int**   matrice_sec;     /**< Matrice d'adjacence - sécurité */
 } Graphe;
 
+/**
+ * @brief Copie compacte (CSR) des listes d'adjacence
+ * @details Les arcs du nœud u occupent [debut[u], debut[u+1]) dans des
+ *          tableaux plats : parcours contigu, sans pointeur à suivre.
+ *          En mode inverse, voisin[] contient l'origine des arcs entrants.
+ */
+typedef struct GrapheCSR {
+    int    nb_noeuds;        /**< Taille de l'index (= capacite_max du graphe) */
+    int    nb_arcs;          /**< Nombre d'arcs conservés */
+    int    est_inverse;      /**< 1 = arcs entrants, 0 = arcs sortants */
+    int*   debut;            /**< nb_noeuds + 1 entrées */
+    int*   voisin;           /**< Extrémité opposée de chaque arc */
+    float* latence;
+    float* bande_passante;
+    float* cout;
+    int*   securite;
+} GrapheCSR;
+
 /* ============================================================
  *  MODULE 2 : STRUCTURES DE ROUTAGE
  * ============================================================ */
@@ -163,18 +181,78 @@ typedef struct FileSimple {
     int taille;
 } FileSimple;
 
+/**
+ * @brief Element d'un tas binaire : valeur entiere associee a une cle
+ */
+typedef struct ElementTas {
+    float cle;
+    int   valeur;
+} ElementTas;
+
+/**
+ * @brief Tas binaire min (file de priorite en tableau)
+ */
+typedef struct TasMin {
+    ElementTas* elements;
+    int taille;
+    int capacite;
+} TasMin;
+
 /* ============================================================
  *  STRUCTURE RÉSULTATS D'ANALYSE SÉCURITÉ
  * ============================================================ */
 
+/**
+ * @brief Centralité d'intermédiarité (Brandes) des nœuds et des liens
+ * @details Valeur d'un nœud : somme, sur les paires (s, t), de la part des
+ *          plus courts chemins s -> t qui passent par lui. Sur un graphe
+ *          non orienté chaque paire est comptée une fois et un lien réunit
+ *          les deux sens.
+ */
+typedef struct ResultatCentralite {
+    int     nb_noeuds;         /**< capacite_max du graphe */
+    double* noeuds;            /**< Centralité de chaque nœud */
+    int*    classement;        /**< Nœuds actifs, centralité décroissante */
+    int     nb_classes;
+    int*    liens;             /**< Paires à plat (src, dest), centralité décroissante */
+    double* centralite_liens;  /**< Alignée sur liens */
+    int     nb_liens;
+    double  temps_ms;
+} ResultatCentralite;
+
+/**
+ * @brief Fonction de voisinage estimée (HyperANF) et mesures dérivées
+ * @details fonction[t] estime le nombre de paires (u, v) telles que
+ *          d(u, v) <= t, u = v compris ; distances en nombre de sauts,
+ *          dans le sens des arcs.
+ */
+typedef struct ResultatVoisinage {
+    int     nb_noeuds;           /**< capacite_max du graphe */
+    int     nb_registres;        /**< Registres HyperLogLog par compteur */
+    double* fonction;            /**< nb_iterations + 1 valeurs */
+    int     nb_iterations;       /**< Dernier tour où un compteur a changé (≈ diamètre) */
+    double  paires_atteignables; /**< Paires à distance >= 1 */
+    double  distance_moyenne;
+    double  diametre_effectif;   /**< Centile VOISINAGE_CENTILE des distances, interpolé */
+    double* proximite;           /**< Closeness : (atteints - 1) / somme des distances */
+    double* harmonique;          /**< Σ 1 / d(v, w) */
+    double  temps_ms;
+} ResultatVoisinage;
+
 typedef struct ResultatSecurite {
     int*  points_articulation; /**< Tableau des IDs des nœuds critiques */
     int   nb_points_articulation;
-    int** ponts;               /**< Tableau de paires [src, dest] */
+    int*  ponts;               /**< Paires à plat : pont i = ponts[2i] -> ponts[2i+1] */
     int   nb_ponts;
     int*  composantes;         /**< composantes[i] = ID du SCC du nœud i */
     int   nb_composantes;
     int   a_cycle;             /**< 1 si un cycle a été détecté */
+    /* Durée des phases de analyser_securite (ms) */
+    double temps_init_ms;      /**< Allocation et initialisation des tableaux */
+    double temps_parcours_ms;  /**< Parcours unique (cycle, low, SCC) */
+    double temps_collecte_ms;  /**< Extraction des résultats */
+    ResultatCentralite* centralite; /**< Classement (analyser_securite_approfondie), NULL sinon */
+    ResultatVoisinage*  voisinage;  /**< Santé du réseau (analyser_securite_approfondie), NULL sinon */
 } ResultatSecurite;
 
 #endif /* INTERFACES_H */
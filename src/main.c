@@ -15,8 +15,11 @@
 #include "graphe.h"
 #include "dijkstra.h"
 #include "securite.h"
+#include "securite_dynamique.h"
+#include "connectivite.h"
 #include "liste_chainee.h"
 #include "backtracking.h"
+#include "etiquettes.h"
 
 /* ============================================================
  *  MENUS INTERACTIFS
@@ -46,6 +49,18 @@ static void afficher_menu_principal(void) {
     printf("| 14. Simulation de flux de paquets                |\n");
     printf("| 15. Sauvegarder le réseau                        |\n");
     printf("+--------------------------------------------------+\n");
+    printf("| 16. Chemin à bande passante maximale             |\n");
+    printf("| 17. Serveurs les plus proches (anycast)          |\n");
+    printf("| 18. Chemin avec budget (étiquettes)              |\n");
+    printf("| 19. Front de Pareto (latence/coût/sécurité)      |\n");
+    printf("| 20. Plus court chemin à sauts limités            |\n");
+    printf("| 21. Route par points de passage obligatoires     |\n");
+    printf("| 22. Impact d'une panne de nœud (arbre des blocs) |\n");
+    printf("| 23. Accessibilité entre zones (préfixes de nom)  |\n");
+    printf("| 24. Chemins disjoints et coupe minimale          |\n");
+    printf("| 25. Redondance k chemins entre sites             |\n");
+    printf("| 26. Analyse approfondie (centralité, voisinage)  |\n");
+    printf("+--------------------------------------------------+\n");
     printf("|  0. Quitter                                      |\n");
     printf("+--------------------------------------------------+\n");
     printf("Votre choix : ");
@@ -101,12 +116,227 @@ static void action_backtracking(const Graphe* g) {
     c.noeuds_oblgatoires = NULL; c.nb_obligatoires = 0;
     c.noeuds_exclus      = NULL; c.nb_exclus = 0;
 
+    int k = saisir_entier("  Alternatives (K)   : ");
+
     printf("  [Recherche en cours avec backtracking...]\n");
+    if (k > 1) {
+        Chemin* liste = k_chemins_contraints(g, src, dest, &c, k, NULL, NULL);
+        if (!liste) printf("  Aucun chemin satisfaisant les contraintes.\n");
+        int i = 1;
+        for (Chemin* ch = liste; ch; ch = ch->suivant) {
+            printf("\n--- Alternative %d ---\n", i++);
+            afficher_chemin(ch, g);
+        }
+        detruire_liste_chemins(liste);
+        return;
+    }
     Chemin* chemin = chemin_contraint_backtracking(g, src, dest, &c);
     if (chemin) { afficher_chemin(chemin, g); detruire_chemin(chemin); }
     else printf("  Aucun chemin satisfaisant les contraintes.\n");
 }
 
+static void action_bande_passante_max(const Graphe* g) {
+    int src  = saisir_entier("  Nœud source      : ");
+    int dest = saisir_entier("  Nœud destination : ");
+    if (!noeud_existe(g, src) || !noeud_existe(g, dest)) {
+        printf("  [ERREUR] Nœuds invalides.\n"); return;
+    }
+    Chemin* c = chemin_bande_passante_max(g, src, dest);
+    if (c) { afficher_chemin(c, g); detruire_chemin(c); }
+    else printf("  Aucun chemin trouvé.\n");
+}
+
+static void action_serveurs_proches(const Graphe* g) {
+    int client = saisir_entier("  Nœud client      : ");
+    int k      = saisir_entier("  K serveurs       : ");
+    if (!noeud_existe(g, client) || k <= 0) {
+        printf("  [ERREUR] Paramètres invalides.\n"); return;
+    }
+    int* serveurs = (int*)malloc(g->capacite_max * sizeof(int));
+    int nb = trouver_noeuds_prefixe(g, "Serveur_", serveurs);
+    if (nb == 0) {
+        printf("  Aucun serveur (préfixe Serveur_).\n");
+        free(serveurs); return;
+    }
+    if (k > nb) k = nb;
+    int* ids = (int*)malloc(k * sizeof(int));
+    float* d = (float*)malloc(k * sizeof(float));
+    int trouves = k_sources_plus_proches(g, client, serveurs, nb, k, ids, d);
+    if (trouves == 0) printf("  Aucun serveur accessible.\n");
+    for (int i = 0; i < trouves; i++)
+        printf("  %d. %s (%.2f ms)\n", i + 1, g->noeuds[ids[i]].nom, d[i]);
+    free(serveurs); free(ids); free(d);
+}
+
+static void action_etiquettes(const Graphe* g) {
+    int src  = saisir_entier("  Nœud source      : ");
+    int dest = saisir_entier("  Nœud destination : ");
+
+    Contraintes c;
+    c.bw_min_requise    = saisir_float("  BW minimale (Mbps) : ");
+    c.cout_max_autorise = saisir_float("  Budget maximum     : ");
+    c.securite_min      = saisir_entier("  Sécurité min (0-10): ");
+    c.noeuds_oblgatoires = NULL; c.nb_obligatoires = 0;
+    c.noeuds_exclus      = NULL; c.nb_exclus = 0;
+
+    StatsEtiquettes stats;
+    Chemin* chemin = etiquettes_avec_stats(g, src, dest, &c, &stats);
+    if (chemin) { afficher_chemin(chemin, g); detruire_chemin(chemin); }
+    else printf("  Aucun chemin satisfaisant les contraintes.\n");
+    afficher_stats_etiquettes(&stats);
+}
+
+static void action_front_pareto(const Graphe* g) {
+    int src  = saisir_entier("  Nœud source      : ");
+    int dest = saisir_entier("  Nœud destination : ");
+    int nb = 0, tronque = 0;
+    Chemin* front = front_pareto(g, src, dest, NULL, NULL, &nb, &tronque);
+    printf("  %d chemin(s) non dominé(s)%s\n", nb, tronque ? " (front tronqué)" : "");
+    int i = 1;
+    for (Chemin* c = front; c; c = c->suivant) {
+        printf("\n--- Compromis %d ---\n", i++);
+        afficher_chemin(c, g);
+    }
+    detruire_liste_chemins(front);
+}
+
+static void action_sauts_max(const Graphe* g) {
+    int src   = saisir_entier("  Nœud source      : ");
+    int dest  = saisir_entier("  Nœud destination : ");
+    int h_max = saisir_entier("  Sauts maximum    : ");
+    Chemin* c = chemin_sauts_max(g, src, dest, h_max);
+    if (c) { afficher_chemin(c, g); detruire_chemin(c); }
+    else printf("  Aucun chemin en au plus %d saut(s).\n", h_max);
+}
+
+static void action_points_passage(const Graphe* g) {
+    int src  = saisir_entier("  Nœud source      : ");
+    int dest = saisir_entier("  Nœud destination : ");
+    int nb   = saisir_entier("  Nb obligatoires  : ");
+    if (nb < 0) nb = 0;
+
+    Contraintes c;
+    c.bw_min_requise    = saisir_float("  BW minimale (Mbps) : ");
+    c.cout_max_autorise = saisir_float("  Budget maximum     : ");
+    c.securite_min      = saisir_entier("  Sécurité min (0-10): ");
+    c.noeuds_oblgatoires = (int*)malloc((nb > 0 ? nb : 1) * sizeof(int));
+    c.nb_obligatoires    = nb;
+    c.noeuds_exclus      = NULL; c.nb_exclus = 0;
+    for (int i = 0; i < nb; i++)
+        c.noeuds_oblgatoires[i] = saisir_entier("  Obligatoire      : ");
+
+    StatsPassage stats;
+    Chemin* chemin = chemin_points_passage(g, src, dest, &c, 0, &stats);
+    if (chemin) {
+        afficher_chemin(chemin, g);
+        printf("  Ordre %s, route %s (%.3f ms)\n",
+               stats.ordre_exact ? "optimal" : "approche",
+               stats.chemin_simple ? "simple" : "avec repassages", stats.temps_ms);
+        detruire_chemin(chemin);
+    }
+    else printf("  Aucune route satisfaisant les contraintes.\n");
+    free(c.noeuds_oblgatoires);
+}
+
+static void action_panne_noeud(const Graphe* g) {
+    int panne = saisir_entier("  Nœud en panne    : ");
+    int coeur = saisir_entier("  Nœud cœur        : ");
+    ArbreBlocs* ab = construire_arbre_blocs(g);
+    int* coupes = (int*)malloc(g->capacite_max * sizeof(int));
+    int nb = sommets_isoles_par_panne(ab, panne, coeur, coupes);
+    if (nb < 0) printf("  [ERREUR] Nœuds invalides.\n");
+    else if (nb == 0) printf("  Aucun nœud coupé du cœur.\n");
+    else {
+        printf("  %d nœud(s) coupé(s) du cœur :\n", nb);
+        for (int i = 0; i < nb; i++)
+            printf("  [COUPÉ] Nœud %d - %s\n", coupes[i], g->noeuds[coupes[i]].nom);
+    }
+    free(coupes);
+    detruire_arbre_blocs(ab);
+}
+
+/* Zones = nœuds dont le nom commence par un préfixe (ex. « Serveur_ ») */
+static void action_accessibilite_zones(const Graphe* g) {
+    char prefixe_a[50], prefixe_b[50];
+    printf("  Préfixe zone A : "); scanf("%49s", prefixe_a);
+    printf("  Préfixe zone B : "); scanf("%49s", prefixe_b);
+    int* zone_a = (int*)malloc(g->capacite_max * sizeof(int));
+    int* zone_b = (int*)malloc(g->capacite_max * sizeof(int));
+    int nb_a = trouver_noeuds_prefixe(g, prefixe_a, zone_a);
+    int nb_b = trouver_noeuds_prefixe(g, prefixe_b, zone_b);
+    if (nb_a == 0 || nb_b == 0) {
+        printf("  [ERREUR] Zone vide.\n");
+    } else {
+        IndexAccessibilite* idx = construire_index_accessibilite(g, 0);
+        printf("  %d SCC, %d arc(s) entre SCC\n", idx->nb_composantes, idx->nb_arcs_dag);
+        if (zone_peut_atteindre(idx, zone_a, nb_a, zone_b, nb_b)) {
+            int liens = 0;
+            for (int i = 0; i < nb_a; i++)
+                for (int j = 0; j < nb_b; j++) liens += peut_atteindre(idx, zone_a[i], zone_b[j]);
+            printf("  [ALERTE] La zone A atteint la zone B (%d paire(s) sur %d).\n",
+                   liens, nb_a * nb_b);
+        } else {
+            printf("  [OK] Aucun chemin de la zone A vers la zone B.\n");
+        }
+        detruire_index_accessibilite(idx);
+    }
+    free(zone_a); free(zone_b);
+}
+
+static void afficher_coupe(const CoupeMin* c, const Graphe* g, int en_liens) {
+    for (int i = 0; i < c->nb; i++) {
+        if (en_liens)
+            printf("    [COUPE] %s -> %s\n", g->noeuds[c->elements[2 * i]].nom,
+                   g->noeuds[c->elements[2 * i + 1]].nom);
+        else
+            printf("    [COUPE] Nœud %d - %s\n", c->elements[i], g->noeuds[c->elements[i]].nom);
+    }
+}
+
+static void action_connectivite(const Graphe* g) {
+    int s = saisir_entier("  Nœud source      : ");
+    int t = saisir_entier("  Nœud destination : ");
+    CoupeMin c = {0};
+    int lambda = connectivite_aretes(g, s, t, &c);
+    if (lambda < 0) { printf("  [ERREUR] Nœuds invalides.\n"); return; }
+    printf("  %d chemin(s) sans lien commun ; liens à couper :\n", lambda);
+    afficher_coupe(&c, g, 1);
+    liberer_coupe(&c);
+    int kappa = connectivite_noeuds(g, s, t, &c);
+    printf("  %d chemin(s) sans nœud commun ; nœuds à retirer :\n", kappa);
+    afficher_coupe(&c, g, 0);
+    if (kappa > c.nb) printf("    + %d lien(s) direct(s)\n", kappa - c.nb);
+    liberer_coupe(&c);
+}
+
+/* Sites = nœuds dont le nom commence par un préfixe */
+static void action_redondance(const Graphe* g) {
+    char prefixe[50];
+    printf("  Préfixe des sites : "); scanf("%49s", prefixe);
+    int k = saisir_entier("  Chemins exigés (k) : ");
+    int mode = saisir_entier("  Disjoints par (1=liens, 2=nœuds) : ");
+    int* sites = (int*)malloc(g->capacite_max * sizeof(int));
+    int nb = trouver_noeuds_prefixe(g, prefixe, sites);
+    int* faibles = (int*)malloc((2 * nb * nb + 1) * sizeof(int));
+    int nb_faibles = verifier_redondance(g, sites, nb, k, mode == 2, faibles);
+    if (nb < 2 || nb_faibles < 0) {
+        printf("  [ERREUR] Moins de 2 sites ou k invalide.\n");
+    } else if (nb_faibles == 0) {
+        printf("  [OK] Les %d sites sont tous reliés par au moins %d chemins disjoints.\n", nb, k);
+    } else {
+        printf("  [ALERTE] %d paire(s) avec moins de %d chemins disjoints :\n", nb_faibles, k);
+        for (int i = 0; i < nb_faibles && i < 20; i++)
+            printf("    %s - %s\n", g->noeuds[faibles[2 * i]].nom, g->noeuds[faibles[2 * i + 1]].nom);
+        if (nb_faibles > 20) printf("    ...\n");
+    }
+    CoupeMin c = {0};
+    int lambda = connectivite_globale_aretes(g, &c);
+    liberer_coupe(&c);
+    printf("  Réseau entier : %d-connexe en liens, %d-connexe en nœuds\n",
+           lambda, connectivite_globale_noeuds(g, NULL));
+    free(sites); free(faibles);
+}
+
 static void action_simulation(void) {
     int capacite  = saisir_entier("  Capacité de la file : ");
     int nb_paquets = saisir_entier("  Nombre de paquets   : ");
@@ -118,12 +348,21 @@ static void action_simulation(void) {
     detruire_file_attente(f);
 }
 
+/* Après une modification d'arête : état de sécurité sans analyse complète */
+static void afficher_etat_dynamique(SecuriteDynamique* sd) {
+    printf("  Réseau %s (%d composante(s)) | %d pont(s), %d point(s) critique(s)\n",
+           securite_dyn_nb_composantes(sd) == 1 ? "connexe" : "NON connexe",
+           securite_dyn_nb_composantes(sd),
+           securite_dyn_nb_ponts(sd), securite_dyn_nb_articulations(sd));
+}
+
 /* ============================================================
  *  MAIN
  * ============================================================ */
 
 int main(int argc, char* argv[]) {
     Graphe* g = NULL;
+    SecuriteDynamique* sd = NULL; /* Suivi des arêtes, créé à la première modification */
     int choix;
 
     #ifdef _WIN32
@@ -147,11 +386,15 @@ int main(int argc, char* argv[]) {
                 char fichier[256];
                 printf("  Chemin du fichier : "); scanf("%255s", fichier);
                 Graphe* nouveau = charger_graphe(fichier);
-                if (nouveau) { detruire_graphe(g); g = nouveau; }
+                if (nouveau) {
+                    detruire_securite_dynamique(sd); sd = NULL;
+                    detruire_graphe(g); g = nouveau;
+                }
                 break;
             }
             case 2: {
                 int n = saisir_entier("  Nombre de nœuds max : ");
+                detruire_securite_dynamique(sd); sd = NULL;
                 detruire_graphe(g);
                 g = creer_graphe(n, 1);
                 printf("  Graphe vide créé (%d nœuds max).\n", n);
@@ -168,8 +411,10 @@ int main(int argc, char* argv[]) {
                     int id = saisir_entier("  ID : ");
                     char nom[TAILLE_MAX_NOM];
                     printf("  Nom : "); scanf("%49s", nom);
-                    if (ajouter_noeud(g, id, nom) == 0)
+                    if (ajouter_noeud(g, id, nom) == 0) {
+                        detruire_securite_dynamique(sd); sd = NULL;
                         printf("  Nœud ajouté.\n");
+                    }
                 } else {
                     int s = saisir_entier("  Source : ");
                     int d = saisir_entier("  Dest   : ");
@@ -177,8 +422,11 @@ int main(int argc, char* argv[]) {
                     float bw  = saisir_float("  BW       : ");
                     float cout = saisir_float("  Coût     : ");
                     int sec   = saisir_entier("  Sécurité : ");
-                    if (ajouter_arete(g, s, d, lat, bw, cout, sec) == 0)
+                    if (!sd) sd = creer_securite_dynamique(g);
+                    if (securite_dyn_ajouter_arete(sd, g, s, d, lat, bw, cout, sec) == 0) {
                         printf("  Arête ajoutée.\n");
+                        afficher_etat_dynamique(sd);
+                    }
                 }
                 break;
             }
@@ -187,11 +435,15 @@ int main(int argc, char* argv[]) {
                 int type = saisir_entier("  Supprimer (1=nœud, 2=arête) : ");
                 if (type == 1) {
                     int id = saisir_entier("  ID du nœud : ");
-                    supprimer_noeud(g, id);
+                    if (supprimer_noeud(g, id) == 0) {
+                        detruire_securite_dynamique(sd); sd = NULL;
+                    }
                 } else {
                     int s = saisir_entier("  Source : ");
                     int d = saisir_entier("  Dest   : ");
-                    supprimer_arete(g, s, d);
+                    if (!sd) sd = creer_securite_dynamique(g);
+                    if (securite_dyn_supprimer_arete(sd, g, s, d) == 0)
+                        afficher_etat_dynamique(sd);
                 }
                 break;
             }
@@ -239,6 +491,8 @@ int main(int argc, char* argv[]) {
                 ResultatSecurite res = {0};
                 trouver_points_articulation(g, &res);
                 afficher_resultats_securite(&res, g);
+                free(res.points_articulation);
+                free(res.ponts);
                 break;
             }
             case 13: {
@@ -260,6 +514,53 @@ int main(int argc, char* argv[]) {
                     printf("  Sauvegarde réussie.\n");
                 break;
             }
+            case 16:
+                if (!g) { printf("  Aucun réseau chargé.\n"); break; }
+                action_bande_passante_max(g);
+                break;
+            case 17:
+                if (!g) { printf("  Aucun réseau chargé.\n"); break; }
+                action_serveurs_proches(g);
+                break;
+            case 18:
+                if (!g) break;
+                action_etiquettes(g);
+                break;
+            case 19:
+                if (!g) break;
+                action_front_pareto(g);
+                break;
+            case 20:
+                if (!g) break;
+                action_sauts_max(g);
+                break;
+            case 21:
+                if (!g) break;
+                action_points_passage(g);
+                break;
+            case 22:
+                if (!g) break;
+                action_panne_noeud(g);
+                break;
+            case 23:
+                if (!g) break;
+                action_accessibilite_zones(g);
+                break;
+            case 24:
+                if (!g) break;
+                action_connectivite(g);
+                break;
+            case 25:
+                if (!g) break;
+                action_redondance(g);
+                break;
+            case 26: {
+                if (!g) break;
+                ResultatSecurite* res = analyser_securite_approfondie(g);
+                afficher_resultats_securite(res, g);
+                detruire_resultat_securite(res);
+                break;
+            }
             case 0:
                 printf("\nAu revoir !\n");
                 break;
@@ -268,6 +569,7 @@ int main(int argc, char* argv[]) {
         }
     } while (choix != 0);
 
+    detruire_securite_dynamique(sd);
     detruire_graphe(g);
     return 0;
 }
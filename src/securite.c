@@ -5,241 +5,1635 @@
 
 #include "securite.h"
 #include "utils.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/* ============================================================
+ *  PILE EXPLICITE DES PARCOURS EN PROFONDEUR
+ *  Chaque nœud en cours d'exploration occupe un cadre (nœud + curseur
+ *  sur sa prochaine arête) ; la pile est allouée une fois (V cadres),
+ *  la profondeur n'est plus limitée par la pile d'appels.
+ * ============================================================ */
+
+typedef struct CadreDFS {
+    int    noeud;
+    int    nb_enfants;  /**< Enfants dans l'arbre DFS (points d'articulation) */
+    Arete* arete;       /**< Prochaine arête sortante à examiner */
+} CadreDFS;
+
+static void empiler_cadre(CadreDFS* pile, int* h, const Graphe* g, int u) {
+    pile[*h].noeud      = u;
+    pile[*h].nb_enfants = 0;
+    pile[*h].arete      = g->noeuds[u].aretes;
+    (*h)++;
+}
 
 /* ============================================================
  *  DFS et BFS
  * ============================================================ */
 
-static void dfs_recursif(const Graphe* g, int u, int* visite,
-                          int* ordre, int* idx) {
-    visite[u] = 1;
-    ordre[(*idx)++] = u;
-    Arete* a = g->noeuds[u].aretes;
-    while (a) {
-        if (!visite[a->destination])
-            dfs_recursif(g, a->destination, visite, ordre, idx);
-        a = a->suivant;
+static void dfs_iteratif(const Graphe* g, int depart, int* visite,
+                         CadreDFS* pile, int* ordre, int* idx) {
+    int h = 0;
+    visite[depart] = 1;
+    ordre[(*idx)++] = depart;
+    empiler_cadre(pile, &h, g, depart);
+    while (h > 0) {
+        CadreDFS* f = &pile[h - 1];
+        Arete* a = f->arete;
+        while (a && visite[a->destination]) a = a->suivant;
+        if (!a) { h--; continue; }   /* Plus de voisin : retour arrière */
+        f->arete = a->suivant;
+        int v = a->destination;
+        visite[v] = 1;
+        ordre[(*idx)++] = v;
+        empiler_cadre(pile, &h, g, v);
     }
 }
 
 void dfs(const Graphe* g, int depart, int* ordre, int* nb_visites) {
     int* visite = (int*)calloc(g->capacite_max, sizeof(int));
+    CadreDFS* pile = (CadreDFS*)malloc(g->capacite_max * sizeof(CadreDFS));
     *nb_visites = 0;
-    dfs_recursif(g, depart, visite, ordre, nb_visites);
+    dfs_iteratif(g, depart, visite, pile, ordre, nb_visites);
+    free(pile);
     free(visite);
 }
 
 void bfs(const Graphe* g, int depart, int* ordre, int* nb_visites) {
-    int* visite = (int*)calloc(g->capacite_max, sizeof(int));
-    *nb_visites = 0;
+    *nb_visites = parcours_largeur(g, depart, ordre, 1);
+}
 
-    FileSimple* file = creer_file_simple();
-    enfiler_simple(file, depart);
-    visite[depart] = 1;
+/* ============================================================
+ *  MOTEUR D'ANALYSE EN UN SEUL PARCOURS
+ *  Un même DFS (même forêt, mêmes temps de découverte) fournit :
+ *    - cycle : arc vers un nœud qui a encore son cadre (coloration
+ *      3 états : EN_COURS tant que le cadre est dans la pile)
+ *    - points d'articulation et ponts (Tarjan-Hopcroft) : low[u] = plus
+ *      petit disc accessible depuis le sous-arbre de u, hors arc parent
+ *    - SCC (Tarjan) : low_scc[u], mêmes règles mais limité aux nœuds
+ *      encore sur la pile des composantes
+ *  disc[] est commun ; les deux low restent distincts car les deux
+ *  algorithmes ne retiennent pas les mêmes arcs.
+ *  Complexité : O(V + E) pour les trois analyses réunies
+ * ============================================================ */
+
+typedef struct ContextSecurite {
+    const Graphe* g;
+    int*  disc;        /**< Temps de découverte (-1 : non visité) */
+    int*  low;         /**< low des points d'articulation et des ponts */
+    int*  low_scc;     /**< low de Tarjan (SCC) */
+    int*  parent;      /**< Parent dans l'arbre DFS */
+    char* couleur;     /**< NON_VISITE, EN_COURS (cadre empilé), VISITE */
+    char* est_ap;      /**< est_ap[u] = 1 si u est point d'articulation */
+    char* sur_pile;    /**< u est sur la pile des composantes */
+    int*  composante;  /**< composante[u] = numéro du SCC de u */
+    int*  pile;        /**< Pile des nœuds du SCC en cours (V entrées) */
+    int   sommet;
+    CadreDFS* cadres;  /**< Pile explicite du parcours (V cadres) */
+    int   timer;
+    int   nb_scc;
+    int   a_cycle;
+    int   arret_au_cycle; /**< 1 : s'arrêter au premier cycle (detecter_cycle) */
+    /* Ponts : paires à plat, capacité doublée au besoin */
+    int*  ponts;
+    int   nb_ponts;
+    int   capa_ponts;
+    /* Blocs (construire_arbre_blocs) : au plus V blocs et 2V sommets à plat */
+    int*  pile_blocs;
+    int   sommet_blocs;
+    int*  bloc_debut;   /**< nb_blocs + 1 entrées */
+    int*  bloc_sommets;
+    int   nb_bloc_sommets;
+    int   nb_blocs;
+} ContextSecurite;
+
+static void init_context_securite(ContextSecurite* ctx, const Graphe* g) {
+    int V = g->capacite_max;
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->g          = g;
+    ctx->disc       = (int*) malloc(V * sizeof(int));
+    ctx->low        = (int*) malloc(V * sizeof(int));
+    ctx->low_scc    = (int*) malloc(V * sizeof(int));
+    ctx->parent     = (int*) malloc(V * sizeof(int));
+    ctx->couleur    = (char*)calloc(V, sizeof(char));
+    ctx->est_ap     = (char*)calloc(V, sizeof(char));
+    ctx->sur_pile   = (char*)calloc(V, sizeof(char));
+    ctx->composante = (int*) malloc(V * sizeof(int));
+    ctx->pile       = (int*) malloc(V * sizeof(int));
+    ctx->cadres     = (CadreDFS*)malloc(V * sizeof(CadreDFS));
+    for (int i = 0; i < V; i++) {
+        ctx->disc[i] = ctx->low[i] = ctx->low_scc[i] = -1;
+        ctx->parent[i] = -1;
+        ctx->composante[i] = -1;
+    }
+}
+
+/* Libère les tableaux de travail (les résultats transmis sont mis à NULL) */
+static void liberer_context_securite(ContextSecurite* ctx) {
+    free(ctx->disc); free(ctx->low); free(ctx->low_scc); free(ctx->parent);
+    free(ctx->couleur); free(ctx->est_ap); free(ctx->sur_pile);
+    free(ctx->composante); free(ctx->pile); free(ctx->cadres);
+    free(ctx->ponts);
+    free(ctx->pile_blocs); free(ctx->bloc_debut); free(ctx->bloc_sommets);
+}
+
+static void ajouter_pont(ContextSecurite* ctx, int u, int v) {
+    if (ctx->nb_ponts == ctx->capa_ponts) {
+        ctx->capa_ponts = ctx->capa_ponts ? 2 * ctx->capa_ponts : 16;
+        ctx->ponts = (int*)realloc(ctx->ponts, 2 * ctx->capa_ponts * sizeof(int));
+    }
+    ctx->ponts[2 * ctx->nb_ponts]     = u;
+    ctx->ponts[2 * ctx->nb_ponts + 1] = v;
+    ctx->nb_ponts++;
+}
+
+static void activer_blocs(ContextSecurite* ctx) {
+    int V = ctx->g->capacite_max;
+    ctx->pile_blocs   = (int*)malloc(V * sizeof(int));
+    ctx->bloc_debut   = (int*)malloc((V + 1) * sizeof(int));
+    ctx->bloc_sommets = (int*)malloc(2 * V * sizeof(int));
+    ctx->bloc_debut[0] = 0;
+}
+
+static void ajouter_au_bloc(ContextSecurite* ctx, int v) {
+    ctx->bloc_sommets[ctx->nb_bloc_sommets++] = v;
+}
 
-    while (!file_simple_vide(file)) {
-        int u = defiler_simple(file);
-        ordre[(*nb_visites)++] = u;
-        Arete* a = g->noeuds[u].aretes;
-        while (a) {
-            if (!visite[a->destination]) {
-                visite[a->destination] = 1;
-                enfiler_simple(file, a->destination);
+static void fermer_bloc(ContextSecurite* ctx) {
+    ctx->bloc_debut[++ctx->nb_blocs] = ctx->nb_bloc_sommets;
+}
+
+static void visiter_securite(ContextSecurite* ctx, int* h, int u) {
+    ctx->disc[u] = ctx->low[u] = ctx->low_scc[u] = ctx->timer++;
+    ctx->couleur[u] = EN_COURS;
+    ctx->pile[ctx->sommet++] = u;
+    ctx->sur_pile[u] = 1;
+    empiler_cadre(ctx->cadres, h, ctx->g, u);
+}
+
+static void analyse_dfs(ContextSecurite* ctx, int racine) {
+    CadreDFS* cadres = ctx->cadres;
+    int h = 0;
+    visiter_securite(ctx, &h, racine);
+
+    while (h > 0) {
+        CadreDFS* f = &cadres[h - 1];
+        int u = f->noeud;
+        Arete* a = f->arete;
+        if (a) {
+            f->arete = a->suivant;
+            int v = a->destination;
+            if (ctx->disc[v] == -1) {
+                /* Arête d'arbre : descente vers v */
+                f->nb_enfants++;
+                ctx->parent[v] = u;
+                visiter_securite(ctx, &h, v);
+                continue;
+            }
+            /* Arête de retour = cycle */
+            if (ctx->couleur[v] == EN_COURS) {
+                ctx->a_cycle = 1;
+                if (ctx->arret_au_cycle) return;
             }
-            a = a->suivant;
+            if (v != ctx->parent[u] && ctx->disc[v] < ctx->low[u])
+                ctx->low[u] = ctx->disc[v];
+            if (ctx->sur_pile[v] && ctx->disc[v] < ctx->low_scc[u])
+                ctx->low_scc[u] = ctx->disc[v];
+            continue;
+        }
+
+        /* Sous-arbre de u terminé */
+        ctx->couleur[u] = VISITE;
+
+        /* Racine d'un SCC */
+        if (ctx->low_scc[u] == ctx->disc[u]) {
+            int v;
+            do {
+                v = ctx->pile[--ctx->sommet];
+                ctx->sur_pile[v] = 0;
+                ctx->composante[v] = ctx->nb_scc;
+            } while (v != u);
+            ctx->nb_scc++;
         }
+
+        /* Remontée vers le parent p */
+        if (--h == 0) break;
+        CadreDFS* fp = &cadres[h - 1];
+        int p = fp->noeud;
+        if (ctx->low[u] < ctx->low[p]) ctx->low[p] = ctx->low[u];
+        if (ctx->low_scc[u] < ctx->low_scc[p]) ctx->low_scc[p] = ctx->low_scc[u];
+
+        /* Point d'articulation : racine avec plusieurs enfants */
+        if (ctx->parent[p] == -1 && fp->nb_enfants > 1) ctx->est_ap[p] = 1;
+
+        /* Point d'articulation : non-racine */
+        if (ctx->parent[p] != -1 && ctx->low[u] >= ctx->disc[p])
+            ctx->est_ap[p] = 1;
+
+        /* Pont : low[u] > disc[p] */
+        if (ctx->low[u] > ctx->disc[p]) ajouter_pont(ctx, p, u);
     }
-    detruire_file_simple(file);
-    free(visite);
+}
+
+static void parcourir_securite(ContextSecurite* ctx) {
+    const Graphe* g = ctx->g;
+    for (int i = 0; i < g->capacite_max; i++) {
+        if (!g->noeuds[i].actif || ctx->disc[i] != -1) continue;
+        analyse_dfs(ctx, i);
+        if (ctx->a_cycle && ctx->arret_au_cycle) return;
+    }
+}
+
+/* --- Extraction des résultats (le contexte cède ses tableaux) --- */
+
+static void collecter_articulations(ContextSecurite* ctx, ResultatSecurite* res) {
+    int V = ctx->g->capacite_max;
+    res->nb_points_articulation = 0;
+    for (int i = 0; i < V; i++) if (ctx->est_ap[i]) res->nb_points_articulation++;
+
+    res->points_articulation = (int*)malloc(res->nb_points_articulation * sizeof(int));
+    int idx = 0;
+    for (int i = 0; i < V; i++) if (ctx->est_ap[i]) res->points_articulation[idx++] = i;
+}
+
+static void collecter_ponts(ContextSecurite* ctx, ResultatSecurite* res) {
+    res->ponts    = ctx->ponts;
+    res->nb_ponts = ctx->nb_ponts;
+    ctx->ponts    = NULL;
+}
+
+static void collecter_composantes(ContextSecurite* ctx, ResultatSecurite* res) {
+    res->composantes    = ctx->composante;
+    res->nb_composantes = ctx->nb_scc;
+    ctx->composante     = NULL;
 }
 
 /* ============================================================
- *  DÉTECTION DE CYCLE (DFS avec coloration 3 états)
- *  Complexité : O(V + E)
+ *  DÉTECTION DE CYCLE, POINTS D'ARTICULATION, PONTS, SCC
+ *  Chaque analyse isolée lance le même moteur et n'en garde qu'une
+ *  partie ; detecter_cycle s'arrête au premier arc de retour.
  * ============================================================ */
 
-static int cycle_dfs(const Graphe* g, int u, int* couleur) {
-    couleur[u] = EN_COURS; /* Gris : en exploration */
-    Arete* a = g->noeuds[u].aretes;
-    while (a) {
-        int v = a->destination;
-        if (couleur[v] == EN_COURS) return 1; /* Arête de retour = cycle */
-        if (couleur[v] == NON_VISITE && cycle_dfs(g, v, couleur)) return 1;
-        a = a->suivant;
+int detecter_cycle(const Graphe* g) {
+    ContextSecurite ctx;
+    init_context_securite(&ctx, g);
+    ctx.arret_au_cycle = 1;
+    parcourir_securite(&ctx);
+    int a_cycle = ctx.a_cycle;
+    liberer_context_securite(&ctx);
+    return a_cycle;
+}
+
+void trouver_points_articulation(const Graphe* g, ResultatSecurite* res) {
+    ContextSecurite ctx;
+    init_context_securite(&ctx, g);
+    parcourir_securite(&ctx);
+    collecter_articulations(&ctx, res);
+    collecter_ponts(&ctx, res);
+    liberer_context_securite(&ctx);
+}
+
+void trouver_ponts(const Graphe* g, ResultatSecurite* res) {
+    ContextSecurite ctx;
+    init_context_securite(&ctx, g);
+    parcourir_securite(&ctx);
+    collecter_ponts(&ctx, res);
+    liberer_context_securite(&ctx);
+}
+
+void tarjan_scc(const Graphe* g, ResultatSecurite* res) {
+    ContextSecurite ctx;
+    init_context_securite(&ctx, g);
+    parcourir_securite(&ctx);
+    collecter_composantes(&ctx, res);
+    liberer_context_securite(&ctx);
+}
+
+/* ============================================================
+ *  ARBRE DES BLOCS (BLOCK-CUT TREE)
+ *  Blocs et points d'articulation viennent d'un même parcours de
+ *  Tarjan-Hopcroft sur la vue non orientée (liste d'adjacence
+ *  symétrisée) : les graphes chargés sont orientés, mais une panne coupe
+ *  un lien dans les deux sens. Pile des sommets dépilée jusqu'à u quand
+ *  low[u] >= disc[p], plus p. L'arbre est ensuite enraciné une fois
+ *  pour toutes :
+ *    - entree / fin : numérotation préfixe des nœuds (sous-arbre = intervalle)
+ *    - sommets rangés dans le même ordre : les sommets d'un sous-arbre
+ *      forment eux aussi un intervalle, listé sans parcours
+ *    - tour d'Euler + table creuse : ancêtre commun en O(1)
+ *  La panne de x sépare u et v si et seulement si le nœud de x est sur
+ *  le chemin de l'arbre entre le nœud de u et celui de v.
+ * ============================================================ */
+
+static int moins_profond(const ArbreBlocs* ab, int a, int b) {
+    return ab->profondeur[a] <= ab->profondeur[b] ? a : b;
+}
+
+/* table_euler[k][i] = nœud le moins profond de euler[i .. i + 2^k - 1] */
+static void preparer_ancetres(ArbreBlocs* ab) {
+    int n = ab->taille_euler;
+    int niveaux = 1;
+    while ((1 << niveaux) <= n) niveaux++;
+    ab->nb_niveaux_euler = niveaux;
+    ab->table_euler = (int*)malloc(((size_t)niveaux * n + 1) * sizeof(int));
+    memcpy(ab->table_euler, ab->euler, n * sizeof(int));
+    for (int k = 1; k < niveaux; k++) {
+        const int* prec = ab->table_euler + (size_t)(k - 1) * n;
+        int* cour = ab->table_euler + (size_t)k * n;
+        int pas = 1 << (k - 1);
+        for (int i = 0; i + 2 * pas <= n; i++)
+            cour[i] = moins_profond(ab, prec[i], prec[i + pas]);
     }
-    couleur[u] = VISITE; /* Noir : exploration terminée */
-    return 0;
 }
 
-int detecter_cycle(const Graphe* g) {
-    int* couleur = (int*)calloc(g->capacite_max, sizeof(int));
-    int a_cycle = 0;
-    for (int i = 0; i < g->capacite_max && !a_cycle; i++) {
-        if (g->noeuds[i].actif && couleur[i] == NON_VISITE)
-            a_cycle = cycle_dfs(g, i, couleur);
+static int ancetre_commun(const ArbreBlocs* ab, int a, int b) {
+    int i = ab->premiere[a], j = ab->premiere[b];
+    if (i > j) { int t = i; i = j; j = t; }
+    int k = 31 - __builtin_clz((unsigned)(j - i + 1));
+    const int* ligne = ab->table_euler + (size_t)k * ab->taille_euler;
+    return moins_profond(ab, ligne[i], ligne[j - (1 << k) + 1]);
+}
+
+static int est_ancetre(const ArbreBlocs* ab, int a, int b) {
+    return ab->entree[a] <= ab->entree[b] && ab->entree[b] < ab->fin[a];
+}
+
+/* Enfant de x dont le sous-arbre contient le descendant a (recherche dichotomique) */
+static int enfant_vers(const ArbreBlocs* ab, int x, int a) {
+    int lo = ab->enfants_debut[x], hi = ab->enfants_debut[x + 1] - 1;
+    while (lo < hi) {
+        int m = (lo + hi + 1) / 2;
+        if (ab->entree[ab->enfants[m]] <= ab->entree[a]) lo = m;
+        else hi = m - 1;
+    }
+    return ab->enfants[lo];
+}
+
+/**
+ * @brief Vue non orientée en CSR : u - v pour chaque arc u -> v entre
+ *        nœuds actifs (boucles ignorées, doublons sans effet sur les blocs)
+ */
+static void symetriser_adjacence(const Graphe* g, int** debut, int** adj) {
+    int V = g->capacite_max;
+    int* d = (int*)calloc(V + 2, sizeof(int));
+    for (int u = 0; u < V; u++) {
+        if (!g->noeuds[u].actif) continue;
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            int v = a->destination;
+            if (v == u || !noeud_existe(g, v)) continue;
+            d[u + 2]++; d[v + 2]++;
+        }
+    }
+    for (int u = 0; u < V; u++) d[u + 2] += d[u + 1];
+    int* t = (int*)malloc((d[V + 1] + 1) * sizeof(int));
+    for (int u = 0; u < V; u++) {
+        if (!g->noeuds[u].actif) continue;
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            int v = a->destination;
+            if (v == u || !noeud_existe(g, v)) continue;
+            t[d[u + 1]++] = v;
+            t[d[v + 1]++] = u;
+        }
+    }
+    *debut = d;
+    *adj   = t;
+}
+
+static void visiter_bloc(ContextSecurite* ctx, int* h, const int* debut,
+                         int* curseur, int u) {
+    ctx->disc[u] = ctx->low[u] = ctx->timer++;
+    ctx->pile_blocs[ctx->sommet_blocs++] = u;
+    curseur[u] = debut[u];
+    ctx->cadres[*h].noeud      = u;
+    ctx->cadres[*h].nb_enfants = 0;
+    ctx->cadres[*h].arete      = NULL;
+    (*h)++;
+}
+
+/**
+ * @brief Blocs et points d'articulation de l'arbre DFS issu de racine,
+ *        sur la vue symétrisée (mêmes règles que analyse_dfs)
+ */
+static void blocs_dfs(ContextSecurite* ctx, const int* debut, const int* adj,
+                      int* curseur, int racine) {
+    CadreDFS* cadres = ctx->cadres;
+    int h = 0;
+    visiter_bloc(ctx, &h, debut, curseur, racine);
+
+    while (h > 0) {
+        CadreDFS* f = &cadres[h - 1];
+        int u = f->noeud;
+        if (curseur[u] < debut[u + 1]) {
+            int v = adj[curseur[u]++];
+            if (ctx->disc[v] == -1) {
+                f->nb_enfants++;
+                ctx->parent[v] = u;
+                visiter_bloc(ctx, &h, debut, curseur, v);
+            } else if (v != ctx->parent[u] && ctx->disc[v] < ctx->low[u]) {
+                ctx->low[u] = ctx->disc[v];
+            }
+            continue;
+        }
+
+        /* Remontée vers le parent p */
+        if (--h == 0) break;
+        CadreDFS* fp = &cadres[h - 1];
+        int p = fp->noeud;
+        if (ctx->low[u] < ctx->low[p]) ctx->low[p] = ctx->low[u];
+        if (ctx->parent[p] == -1 && fp->nb_enfants > 1) ctx->est_ap[p] = 1;
+        if (ctx->parent[p] != -1 && ctx->low[u] >= ctx->disc[p]) ctx->est_ap[p] = 1;
+
+        /* Bloc fermé en p : sommets empilés depuis u, plus p */
+        if (ctx->low[u] >= ctx->disc[p]) {
+            int w;
+            do {
+                w = ctx->pile_blocs[--ctx->sommet_blocs];
+                ajouter_au_bloc(ctx, w);
+            } while (w != u);
+            ajouter_au_bloc(ctx, p);
+            fermer_bloc(ctx);
+        }
+    }
+
+    /* La racine reste seule sur la pile ; sans enfant, elle forme son bloc */
+    ctx->sommet_blocs--;
+    if (cadres[0].nb_enfants == 0) {
+        ajouter_au_bloc(ctx, racine);
+        fermer_bloc(ctx);
     }
-    free(couleur);
-    return a_cycle;
+}
+
+/**
+ * @brief Enracine chaque arbre : parcours en profondeur itératif qui
+ *        numérote les nœuds, range les sommets et construit le tour d'Euler
+ */
+static void enraciner_arbre_blocs(ArbreBlocs* ab, const int* adj_debut, const int* adj,
+                                  const int* sommet_coupure, const char* est_ap) {
+    int N = ab->nb_noeuds_arbre, B = ab->nb_blocs;
+    int* pile    = (int*)malloc((N + 1) * sizeof(int));
+    int* curseur = (int*)malloc((N + 1) * sizeof(int));
+    int t = 0, ns = 0;
+    for (int x = 0; x < N; x++) { ab->entree[x] = -1; curseur[x] = adj_debut[x]; }
+
+    for (int r = 0; r < N; r++) {
+        if (ab->entree[r] >= 0) continue;
+        int h = 0;
+        pile[h++] = r;
+        ab->parent[r] = -1;
+        ab->profondeur[r] = 0;
+        while (h > 0) {
+            int x = pile[h - 1];
+            if (ab->entree[x] < 0) {
+                ab->racine[x] = r;
+                ab->entree[x] = t++;
+                ab->premiere[x] = ab->taille_euler;
+                ab->premier_sommet[x] = ns;
+                if (x >= B) ab->ordre_sommets[ns++] = sommet_coupure[x - B];
+                else {
+                    for (int i = ab->bloc_debut[x]; i < ab->bloc_debut[x + 1]; i++)
+                        if (!est_ap[ab->bloc_sommets[i]]) ab->ordre_sommets[ns++] = ab->bloc_sommets[i];
+                }
+            }
+            /* x réapparaît dans le tour après chaque enfant */
+            ab->euler[ab->taille_euler++] = x;
+            int y = -1;
+            while (y < 0 && curseur[x] < adj_debut[x + 1]) {
+                int c = adj[curseur[x]++];
+                if (c != ab->parent[x]) y = c;
+            }
+            if (y >= 0) {
+                ab->parent[y] = x;
+                ab->profondeur[y] = ab->profondeur[x] + 1;
+                pile[h++] = y;
+            } else {
+                ab->fin[x] = t;
+                ab->fin_sommets[x] = ns;
+                h--;
+            }
+        }
+    }
+
+    /* Enfants de chaque nœud, dans l'ordre préfixe */
+    ab->enfants_debut = (int*)calloc(N + 2, sizeof(int));
+    ab->enfants       = (int*)malloc((N + 1) * sizeof(int));
+    for (int x = 0; x < N; x++) if (ab->parent[x] >= 0) ab->enfants_debut[ab->parent[x] + 2]++;
+    for (int x = 0; x < N; x++) ab->enfants_debut[x + 2] += ab->enfants_debut[x + 1];
+    int* par_entree = pile;
+    for (int x = 0; x < N; x++) par_entree[ab->entree[x]] = x;
+    for (int i = 0; i < N; i++) {
+        int x = par_entree[i];
+        if (ab->parent[x] >= 0) ab->enfants[ab->enfants_debut[ab->parent[x] + 1]++] = x;
+    }
+    free(pile);
+    free(curseur);
+}
+
+ArbreBlocs* construire_arbre_blocs(const Graphe* g) {
+    if (!g) return NULL;
+    int V = g->capacite_max;
+    ContextSecurite ctx;
+    init_context_securite(&ctx, g);
+    activer_blocs(&ctx);
+    int *sym_debut, *sym_adj;
+    symetriser_adjacence(g, &sym_debut, &sym_adj);
+    int* curseur = (int*)malloc((V + 1) * sizeof(int));
+    for (int i = 0; i < V; i++)
+        if (g->noeuds[i].actif && ctx.disc[i] == -1)
+            blocs_dfs(&ctx, sym_debut, sym_adj, curseur, i);
+    free(sym_debut); free(sym_adj); free(curseur);
+
+    ArbreBlocs* ab = (ArbreBlocs*)calloc(1, sizeof(ArbreBlocs));
+    int B = ctx.nb_blocs;
+    ab->nb_sommets   = V;
+    ab->nb_blocs     = B;
+    ab->bloc_debut   = ctx.bloc_debut;
+    ab->bloc_sommets = ctx.bloc_sommets;
+    ctx.bloc_debut = ctx.bloc_sommets = NULL;
+
+    /* Nœuds : blocs 0..B-1, puis un nœud par point d'articulation */
+    ab->noeud_de = (int*)malloc(V * sizeof(int));
+    int* sommet_coupure = (int*)malloc((V + 1) * sizeof(int));
+    int N = B;
+    for (int v = 0; v < V; v++) {
+        ab->noeud_de[v] = -1;
+        if (ctx.est_ap[v]) { sommet_coupure[N - B] = v; ab->noeud_de[v] = N++; }
+    }
+    ab->nb_noeuds_arbre = N;
+
+    /* Arêtes bloc - point d'articulation, en CSR */
+    int* adj_debut = (int*)calloc(N + 2, sizeof(int));
+    for (int b = 0; b < B; b++) {
+        for (int i = ab->bloc_debut[b]; i < ab->bloc_debut[b + 1]; i++) {
+            int v = ab->bloc_sommets[i];
+            if (!ctx.est_ap[v]) { ab->noeud_de[v] = b; continue; }
+            adj_debut[b + 2]++;
+            adj_debut[ab->noeud_de[v] + 2]++;
+        }
+    }
+    for (int x = 0; x < N; x++) adj_debut[x + 2] += adj_debut[x + 1];
+    int* adj = (int*)malloc((adj_debut[N + 1] + 1) * sizeof(int));
+    for (int b = 0; b < B; b++) {
+        for (int i = ab->bloc_debut[b]; i < ab->bloc_debut[b + 1]; i++) {
+            int v = ab->bloc_sommets[i];
+            if (!ctx.est_ap[v]) continue;
+            adj[adj_debut[b + 1]++] = ab->noeud_de[v];
+            adj[adj_debut[ab->noeud_de[v] + 1]++] = b;
+        }
+    }
+
+    ab->parent         = (int*)malloc((N + 1) * sizeof(int));
+    ab->profondeur     = (int*)malloc((N + 1) * sizeof(int));
+    ab->racine         = (int*)malloc((N + 1) * sizeof(int));
+    ab->entree         = (int*)malloc((N + 1) * sizeof(int));
+    ab->fin            = (int*)malloc((N + 1) * sizeof(int));
+    ab->premiere       = (int*)malloc((N + 1) * sizeof(int));
+    ab->premier_sommet = (int*)malloc((N + 1) * sizeof(int));
+    ab->fin_sommets    = (int*)malloc((N + 1) * sizeof(int));
+    ab->euler          = (int*)malloc((2 * N + 1) * sizeof(int));
+    ab->ordre_sommets  = (int*)malloc((V + 1) * sizeof(int));
+    enraciner_arbre_blocs(ab, adj_debut, adj, sommet_coupure, ctx.est_ap);
+    preparer_ancetres(ab);
+
+    free(adj_debut); free(adj); free(sommet_coupure);
+    liberer_context_securite(&ctx);
+    return ab;
+}
+
+void detruire_arbre_blocs(ArbreBlocs* ab) {
+    if (!ab) return;
+    free(ab->bloc_debut); free(ab->bloc_sommets); free(ab->noeud_de);
+    free(ab->parent); free(ab->profondeur); free(ab->racine);
+    free(ab->entree); free(ab->fin); free(ab->enfants_debut); free(ab->enfants);
+    free(ab->premier_sommet); free(ab->fin_sommets); free(ab->ordre_sommets);
+    free(ab->premiere); free(ab->euler); free(ab->table_euler);
+    free(ab);
+}
+
+static int sommet_indexe(const ArbreBlocs* ab, int v) {
+    return v >= 0 && v < ab->nb_sommets && ab->noeud_de[v] >= 0;
+}
+
+int connectes_apres_panne(const ArbreBlocs* ab, int u, int v, int panne) {
+    if (!ab || !sommet_indexe(ab, u) || !sommet_indexe(ab, v)) return 0;
+    if (u == panne || v == panne) return 0;
+    int a = ab->noeud_de[u], b = ab->noeud_de[v];
+    if (ab->racine[a] != ab->racine[b]) return 0;
+    if (!sommet_indexe(ab, panne)) return 1;
+    int x = ab->noeud_de[panne];
+    if (x < ab->nb_blocs || ab->racine[x] != ab->racine[a]) return 1;
+    int l = ancetre_commun(ab, a, b);
+    return !(est_ancetre(ab, l, x) && (est_ancetre(ab, x, a) || est_ancetre(ab, x, b)));
+}
+
+/* Copie ordre_sommets[debut, fin) dans sortie (si non NULL) */
+static int copier_sommets(const ArbreBlocs* ab, int debut, int fin, int* sortie) {
+    if (sortie && fin > debut) memcpy(sortie, ab->ordre_sommets + debut, (fin - debut) * sizeof(int));
+    return fin > debut ? fin - debut : 0;
+}
+
+int sommets_isoles_par_panne(const ArbreBlocs* ab, int panne, int coeur, int* sortie) {
+    if (!ab || !sommet_indexe(ab, panne) || !sommet_indexe(ab, coeur) || panne == coeur)
+        return -1;
+    int x = ab->noeud_de[panne], c = ab->noeud_de[coeur];
+    if (x < ab->nb_blocs || ab->racine[x] != ab->racine[c]) return 0;
+
+    /* Le nœud de la panne occupe la première case de son intervalle */
+    if (!est_ancetre(ab, x, c))
+        return copier_sommets(ab, ab->premier_sommet[x] + 1, ab->fin_sommets[x], sortie);
+
+    /* Le cœur est sous x : tout l'arbre sauf la branche du cœur et la panne */
+    int r = ab->racine[x], e = enfant_vers(ab, x, c);
+    int nb = copier_sommets(ab, ab->premier_sommet[r], ab->premier_sommet[x], sortie);
+    nb += copier_sommets(ab, ab->premier_sommet[x] + 1, ab->premier_sommet[e], sortie ? sortie + nb : NULL);
+    nb += copier_sommets(ab, ab->fin_sommets[e], ab->fin_sommets[r], sortie ? sortie + nb : NULL);
+    return nb;
 }
 
 /* ============================================================
- *  POINTS D'ARTICULATION (algorithme de Tarjan-Hopcroft)
- *  Variables : disc[u] = temps découverte, low[u] = plus petit
- *  disc accessible depuis le sous-arbre de u
- *  Complexité : O(V + E)
+ *  SCC PARALLÈLES : AVANT-ARRIÈRE AVEC ÉLAGAGE (FW-BW + trim)
+ *  Une tâche = un ensemble de nœuds de même couleur. Pour une tâche :
+ *    1. élagage : un nœud sans arc entrant ou sortant dans l'ensemble
+ *       est une SCC à lui seul (répété jusqu'à stabilité)
+ *    2. pivot p : F = descendants de p, B = ancêtres de p dans l'ensemble
+ *    3. F ∩ B est la SCC de p ; F \ B, B \ F et le reste ne partagent
+ *       aucune SCC et deviennent trois nouvelles tâches indépendantes
+ *  Les tâches sont réparties entre les threads. Chaque couleur n'est
+ *  utilisée qu'une fois : un parcours ne franchit jamais la frontière
+ *  de sa tâche, les nœuds des autres tâches ont une autre couleur.
+ *  Complexité : O((V + E) * profondeur de découpage), ~O(V + E) en pratique
  * ============================================================ */
 
-typedef struct ContextArticulation {
-    const Graphe* g;
-    int*  disc;      /**< Temps de découverte */
-    int*  low;       /**< Valeur low */
-    int*  parent;    /**< Parent dans l'arbre DFS */
-    int*  est_ap;    /**< est_ap[u] = 1 si u est point d'articulation */
-    int   timer;
-    /* Pour les ponts */
-    int** ponts;
-    int   nb_ponts;
-} ContextArticulation;
+/* En dessous, les sous-tâches restent sur le thread qui les crée */
+#define SCC_TACHE_PARTAGEE 2048
 
-static void ap_dfs(ContextArticulation* ctx, int u) {
-    ctx->disc[u] = ctx->low[u] = ctx->timer++;
-    int nb_enfants = 0;
+typedef struct TacheSCC {
+    int* noeuds;
+    int  nb;
+    int  couleur;
+    struct TacheSCC* suivante;
+} TacheSCC;
 
-    Arete* a = ctx->g->noeuds[u].aretes;
-    while (a) {
-        int v = a->destination;
-        if (ctx->disc[v] == -1) {
-            /* Arête d'arbre */
-            nb_enfants++;
-            ctx->parent[v] = u;
-            ap_dfs(ctx, v);
-
-            /* Mise à jour low[u] */
-            if (ctx->low[v] < ctx->low[u]) ctx->low[u] = ctx->low[v];
-
-            /* Point d'articulation : racine avec plusieurs enfants */
-            if (ctx->parent[u] == -1 && nb_enfants > 1) ctx->est_ap[u] = 1;
-
-            /* Point d'articulation : non-racine */
-            if (ctx->parent[u] != -1 && ctx->low[v] >= ctx->disc[u])
-                ctx->est_ap[u] = 1;
-
-            /* Pont : low[v] > disc[u] */
-            if (ctx->low[v] > ctx->disc[u]) {
-                ctx->ponts = (int**)realloc(ctx->ponts,
-                                (ctx->nb_ponts + 1) * sizeof(int*));
-                ctx->ponts[ctx->nb_ponts] = (int*)malloc(2 * sizeof(int));
-                ctx->ponts[ctx->nb_ponts][0] = u;
-                ctx->ponts[ctx->nb_ponts][1] = v;
-                ctx->nb_ponts++;
+typedef struct PartageSCC {
+    GrapheCSR*       avant;
+    GrapheCSR*       arriere;
+    atomic_int*      couleur;    /**< Couleur de la tâche du nœud, -1 : SCC trouvée */
+    int*             scc;        /**< Numéro brut de SCC */
+    int*             deg_in;     /**< Degrés restreints à la tâche (élagage) */
+    int*             deg_out;
+    int*             marque_av;  /**< Numéro de la dernière tâche ayant atteint v */
+    int*             marque_ar;
+    atomic_int       nb_couleurs;
+    atomic_int       nb_scc;
+    atomic_int       nb_taches_vues;
+    /* File des tâches partagées */
+    pthread_mutex_t  verrou;
+    pthread_cond_t   signal;
+    TacheSCC*        file;
+    int              actifs;     /**< Threads en train de traiter une tâche */
+} PartageSCC;
+
+static TacheSCC* creer_tache_scc(int* noeuds, int nb, int couleur) {
+    TacheSCC* t = (TacheSCC*)malloc(sizeof(TacheSCC));
+    t->noeuds = noeuds; t->nb = nb; t->couleur = couleur; t->suivante = NULL;
+    return t;
+}
+
+static void publier_tache_scc(PartageSCC* p, TacheSCC* t) {
+    pthread_mutex_lock(&p->verrou);
+    t->suivante = p->file;
+    p->file = t;
+    pthread_cond_signal(&p->signal);
+    pthread_mutex_unlock(&p->verrou);
+}
+
+static int couleur_de(const PartageSCC* p, int v) {
+    return atomic_load_explicit(&p->couleur[v], memory_order_relaxed);
+}
+
+static void colorer(PartageSCC* p, int v, int c) {
+    atomic_store_explicit(&p->couleur[v], c, memory_order_relaxed);
+}
+
+static void nouvelle_scc_singleton(PartageSCC* p, int v) {
+    p->scc[v] = atomic_fetch_add(&p->nb_scc, 1);
+    colorer(p, v, -1);
+}
+
+/* Élagage itératif : retourne le nombre de nœuds restants dans la tâche */
+static int elaguer_tache(PartageSCC* p, TacheSCC* t, int* file) {
+    const GrapheCSR* av = p->avant;
+    const GrapheCSR* ar = p->arriere;
+    int c = t->couleur, tete = 0, queue = 0;
+    for (int i = 0; i < t->nb; i++) {
+        int u = t->noeuds[i], din = 0, dout = 0;
+        for (int e = av->debut[u]; e < av->debut[u + 1]; e++)
+            dout += (couleur_de(p, av->voisin[e]) == c);
+        for (int e = ar->debut[u]; e < ar->debut[u + 1]; e++)
+            din += (couleur_de(p, ar->voisin[e]) == c);
+        p->deg_in[u] = din; p->deg_out[u] = dout;
+    }
+    for (int i = 0; i < t->nb; i++) {
+        int u = t->noeuds[i];
+        if (p->deg_in[u] == 0 || p->deg_out[u] == 0) {
+            nouvelle_scc_singleton(p, u);
+            file[queue++] = u;
+        }
+    }
+    while (tete < queue) {
+        int u = file[tete++];
+        for (int e = av->debut[u]; e < av->debut[u + 1]; e++) {
+            int v = av->voisin[e];
+            if (couleur_de(p, v) == c && --p->deg_in[v] == 0) {
+                nouvelle_scc_singleton(p, v);
+                file[queue++] = v;
+            }
+        }
+        for (int e = ar->debut[u]; e < ar->debut[u + 1]; e++) {
+            int v = ar->voisin[e];
+            if (couleur_de(p, v) == c && --p->deg_out[v] == 0) {
+                nouvelle_scc_singleton(p, v);
+                file[queue++] = v;
             }
-        } else if (v != ctx->parent[u]) {
-            /* Arête de retour : mise à jour low */
-            if (ctx->disc[v] < ctx->low[u]) ctx->low[u] = ctx->disc[v];
         }
-        a = a->suivant;
     }
+    return t->nb - queue;
 }
 
-void trouver_points_articulation(const Graphe* g, ResultatSecurite* res) {
+/* Parcours en largeur restreint à la couleur c, marque[v] = id */
+static void atteindre(PartageSCC* p, const GrapheCSR* csr, int depart, int c,
+                      int* marque, int id, int* file) {
+    int tete = 0, queue = 0;
+    marque[depart] = id;
+    file[queue++] = depart;
+    while (tete < queue) {
+        int u = file[tete++];
+        for (int e = csr->debut[u]; e < csr->debut[u + 1]; e++) {
+            int v = csr->voisin[e];
+            if (couleur_de(p, v) == c && marque[v] != id) {
+                marque[v] = id;
+                file[queue++] = v;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Traite une tâche et retourne ses sous-tâches (liste chaînée)
+ */
+static TacheSCC* traiter_tache_scc(PartageSCC* p, TacheSCC* t, int* file) {
+    if (elaguer_tache(p, t, file) == 0) return NULL;
+
+    /* Pivot : produit des degrés maximal, probablement dans une grande SCC */
+    int c = t->couleur, pivot = -1;
+    long meilleur = -1;
+    for (int i = 0; i < t->nb; i++) {
+        int u = t->noeuds[i];
+        if (couleur_de(p, u) != c) continue;
+        long score = (long)p->deg_in[u] * p->deg_out[u];
+        if (score > meilleur) { meilleur = score; pivot = u; }
+    }
+
+    int id = atomic_fetch_add(&p->nb_taches_vues, 1);
+    atteindre(p, p->avant,   pivot, c, p->marque_av, id, file);
+    atteindre(p, p->arriere, pivot, c, p->marque_ar, id, file);
+
+    /* Répartition : SCC du pivot, F \ B, B \ F, reste */
+    int s = atomic_fetch_add(&p->nb_scc, 1);
+    int nb[3] = {0, 0, 0};
+    int* groupe[3];
+    for (int k = 0; k < 3; k++) groupe[k] = (int*)malloc(t->nb * sizeof(int));
+    for (int i = 0; i < t->nb; i++) {
+        int u = t->noeuds[i];
+        if (couleur_de(p, u) != c) continue;
+        int f = (p->marque_av[u] == id), b = (p->marque_ar[u] == id);
+        if (f && b) { p->scc[u] = s; colorer(p, u, -1); }
+        else {
+            int k = f ? 0 : (b ? 1 : 2);
+            groupe[k][nb[k]++] = u;
+        }
+    }
+    TacheSCC* sous = NULL;
+    for (int k = 0; k < 3; k++) {
+        if (nb[k] == 0) { free(groupe[k]); continue; }
+        int nc = atomic_fetch_add(&p->nb_couleurs, 1);
+        for (int i = 0; i < nb[k]; i++) colorer(p, groupe[k][i], nc);
+        TacheSCC* st = creer_tache_scc(groupe[k], nb[k], nc);
+        st->suivante = sous;
+        sous = st;
+    }
+    return sous;
+}
+
+typedef struct TravailleurSCC {
+    PartageSCC* p;
+    int*        file;   /**< File BFS / élagage (V entrées) */
+} TravailleurSCC;
+
+static void* worker_scc(void* arg) {
+    TravailleurSCC* w = (TravailleurSCC*)arg;
+    PartageSCC* p = w->p;
+    pthread_mutex_lock(&p->verrou);
+    for (;;) {
+        while (!p->file && p->actifs > 0) pthread_cond_wait(&p->signal, &p->verrou);
+        if (!p->file) break;                 /* Plus de tâche ni de producteur */
+        TacheSCC* t = p->file;
+        p->file = t->suivante;
+        p->actifs++;
+        pthread_mutex_unlock(&p->verrou);
+
+        /* Les petites sous-tâches sont traitées sur place (pile locale) */
+        TacheSCC* locale = t;
+        locale->suivante = NULL;
+        while (locale) {
+            TacheSCC* cur = locale;
+            locale = cur->suivante;
+            TacheSCC* sous = traiter_tache_scc(p, cur, w->file);
+            free(cur->noeuds); free(cur);
+            while (sous) {
+                TacheSCC* st = sous;
+                sous = st->suivante;
+                if (st->nb >= SCC_TACHE_PARTAGEE) publier_tache_scc(p, st);
+                else { st->suivante = locale; locale = st; }
+            }
+        }
+
+        pthread_mutex_lock(&p->verrou);
+        p->actifs--;
+        if (p->actifs == 0 && !p->file) pthread_cond_broadcast(&p->signal);
+    }
+    pthread_mutex_unlock(&p->verrou);
+    return NULL;
+}
+
+void scc_parallele(const Graphe* g, ResultatSecurite* res, int nb_threads) {
     int V = g->capacite_max;
-    ContextArticulation ctx;
-    ctx.g       = g;
-    ctx.disc    = (int*)malloc(V * sizeof(int));
-    ctx.low     = (int*)malloc(V * sizeof(int));
-    ctx.parent  = (int*)malloc(V * sizeof(int));
-    ctx.est_ap  = (int*)calloc(V, sizeof(int));
-    ctx.timer   = 0;
-    ctx.ponts   = NULL;
-    ctx.nb_ponts = 0;
-
-    for (int i = 0; i < V; i++) { ctx.disc[i] = ctx.low[i] = -1; ctx.parent[i] = -1; }
+    PartageSCC p;
+    p.avant   = construire_csr(g, 0, NULL);
+    p.arriere = construire_csr(g, 1, NULL);
+    p.couleur = (atomic_int*)malloc(V * sizeof(atomic_int));
+    p.scc       = (int*)malloc(V * sizeof(int));
+    p.deg_in    = (int*)malloc(V * sizeof(int));
+    p.deg_out   = (int*)malloc(V * sizeof(int));
+    p.marque_av = (int*)malloc(V * sizeof(int));
+    p.marque_ar = (int*)malloc(V * sizeof(int));
+    atomic_init(&p.nb_couleurs, 1);
+    atomic_init(&p.nb_scc, 0);
+    atomic_init(&p.nb_taches_vues, 0);
+    pthread_mutex_init(&p.verrou, NULL);
+    pthread_cond_init(&p.signal, NULL);
+    p.file = NULL;
+    p.actifs = 0;
 
-    for (int i = 0; i < V; i++)
-        if (g->noeuds[i].actif && ctx.disc[i] == -1) ap_dfs(&ctx, i);
+    /* Tâche initiale : tous les nœuds actifs, couleur 0 */
+    int* tous = (int*)malloc((V > 0 ? V : 1) * sizeof(int));
+    int n = 0;
+    for (int v = 0; v < V; v++) {
+        int actif = g->noeuds[v].actif;
+        atomic_init(&p.couleur[v], actif ? 0 : -1);
+        p.scc[v] = -1;
+        p.marque_av[v] = p.marque_ar[v] = -1;
+        if (actif) tous[n++] = v;
+    }
+    if (n > 0) p.file = creer_tache_scc(tous, n, 0);
+    else free(tous);
 
-    /* Collecter les points d'articulation */
-    res->nb_points_articulation = 0;
-    for (int i = 0; i < V; i++) if (ctx.est_ap[i]) res->nb_points_articulation++;
+    int W = nb_threads > 0 ? nb_threads : nb_threads_disponibles();
+    TravailleurSCC* w = (TravailleurSCC*)malloc(W * sizeof(TravailleurSCC));
+    for (int i = 0; i < W; i++) {
+        w[i].p = &p;
+        w[i].file = (int*)malloc((V > 0 ? V : 1) * sizeof(int));
+    }
+    executer_en_parallele(worker_scc, w, sizeof(TravailleurSCC), W);
 
-    res->points_articulation = (int*)malloc(res->nb_points_articulation * sizeof(int));
-    int idx = 0;
-    for (int i = 0; i < V; i++) if (ctx.est_ap[i]) res->points_articulation[idx++] = i;
+    /* Numérotation canonique : ordre d'apparition du plus petit nœud */
+    int nb_brut = atomic_load(&p.nb_scc);
+    int* renum = (int*)malloc((nb_brut > 0 ? nb_brut : 1) * sizeof(int));
+    for (int i = 0; i < nb_brut; i++) renum[i] = -1;
+    res->composantes    = (int*)malloc((V > 0 ? V : 1) * sizeof(int));
+    res->nb_composantes = 0;
+    for (int v = 0; v < V; v++) {
+        int s = p.scc[v];
+        if (s >= 0 && renum[s] < 0) renum[s] = res->nb_composantes++;
+        res->composantes[v] = s >= 0 ? renum[s] : -1;
+    }
+
+    for (int i = 0; i < W; i++) free(w[i].file);
+    free(w); free(renum);
+    free(p.couleur); free(p.scc); free(p.deg_in); free(p.deg_out);
+    free(p.marque_av); free(p.marque_ar);
+    pthread_mutex_destroy(&p.verrou);
+    pthread_cond_destroy(&p.signal);
+    detruire_csr(p.avant);
+    detruire_csr(p.arriere);
+}
 
-    /* Récupérer les ponts */
-    res->ponts    = ctx.ponts;
-    res->nb_ponts = ctx.nb_ponts;
+/* ============================================================
+ *  INDEX D'ACCESSIBILITÉ SUR LE GRAPHE DES COMPOSANTES
+ *  u atteint v si et seulement si la SCC de u atteint celle de v dans le
+ *  graphe des composantes, qui est sans cycle. Tarjan numérote les SCC
+ *  dans l'ordre où elles se ferment : tout arc du DAG va d'un numéro à
+ *  un numéro plus petit (ordre topologique inverse gratuit).
+ *    - fermeture transitive en bits : ligne(c) = {c} ∪ OU des lignes des
+ *      successeurs, calculée des puits vers les sources ; requête O(1)
+ *    - sinon (trop de composantes) : filtre par numéro, étiquettes
+ *      d'intervalles GRAIL (k parcours postfixes : si c atteint d alors
+ *      l'intervalle de d est inclus dans celui de c), puis parcours
+ *      élagué par ces mêmes filtres
+ * ============================================================ */
 
-    free(ctx.disc); free(ctx.low); free(ctx.parent); free(ctx.est_ap);
+/* Ordre des successeurs propre à chaque parcours GRAIL (générateur congruentiel) */
+static unsigned suivant_aleatoire(unsigned* graine) {
+    *graine = *graine * 1103515245u + 12345u;
+    return *graine >> 16;
+}
+
+static void etiqueter_grail(IndexAccessibilite* idx, int t, int* cadre_curseur) {
+    int C = idx->nb_composantes;
+    int* bas  = idx->bas  + (size_t)t * C;
+    int* haut = idx->haut + (size_t)t * C;
+    int* pile = idx->pile;
+    int* decalage = idx->marque; /* rotation de la liste des successeurs */
+    unsigned graine = 2654435761u * (unsigned)(t + 1);
+    int rang = 0;
+    for (int c = 0; c < C; c++) bas[c] = haut[c] = -1;
+
+    for (int k = 0; k < C; k++) {
+        int r = (t & 1) ? k : C - 1 - k; /* sources d'abord, sens alterné */
+        if (haut[r] >= 0) continue;
+        int h = 0;
+        pile[h++] = r;
+        bas[r] = -2; /* en cours */
+        cadre_curseur[r] = 0;
+        decalage[r] = (int)suivant_aleatoire(&graine);
+        while (h > 0) {
+            int c = pile[h - 1];
+            int deg = idx->dag_debut[c + 1] - idx->dag_debut[c];
+            if (cadre_curseur[c] < deg) {
+                int i = (cadre_curseur[c]++ + decalage[c]) % deg;
+                int d = idx->dag_succ[idx->dag_debut[c] + i];
+                if (haut[d] < 0 && bas[d] != -2) {
+                    bas[d] = -2;
+                    cadre_curseur[d] = 0;
+                    decalage[d] = (int)suivant_aleatoire(&graine);
+                    pile[h++] = d;
+                }
+                continue;
+            }
+            /* Fin de c : rang postfixe, bas = plus petit rang du sous-DAG */
+            h--;
+            haut[c] = rang;
+            int b = rang++;
+            for (int e = idx->dag_debut[c]; e < idx->dag_debut[c + 1]; e++)
+                if (bas[idx->dag_succ[e]] < b) b = bas[idx->dag_succ[e]];
+            bas[c] = b;
+        }
+    }
+}
+
+/* Filtres O(1) et O(k) : 0 = impossible, 1 = à vérifier */
+static int accessible_possible(const IndexAccessibilite* idx, int c, int d) {
+    if (c < d) return 0;
+    int C = idx->nb_composantes;
+    for (int t = 0; t < idx->nb_etiquettes; t++) {
+        const int* bas  = idx->bas  + (size_t)t * C;
+        const int* haut = idx->haut + (size_t)t * C;
+        if (bas[d] < bas[c] || haut[d] > haut[c]) return 0;
+    }
+    return 1;
+}
+
+/* Parcours du DAG depuis c, élagué par les filtres vers d */
+static int parcours_elague(IndexAccessibilite* idx, int c, int d) {
+    int estampille = ++idx->estampille;
+    int h = 0;
+    idx->pile[h++] = c;
+    idx->marque[c] = estampille;
+    while (h > 0) {
+        int x = idx->pile[--h];
+        for (int e = idx->dag_debut[x]; e < idx->dag_debut[x + 1]; e++) {
+            int y = idx->dag_succ[e];
+            if (y == d) return 1;
+            if (idx->marque[y] == estampille || !accessible_possible(idx, y, d)) continue;
+            idx->marque[y] = estampille;
+            idx->pile[h++] = y;
+        }
+    }
+    return 0;
+}
+
+IndexAccessibilite* construire_index_accessibilite(const Graphe* g, int max_fermeture) {
+    if (!g) return NULL;
+    int V = g->capacite_max;
+    IndexAccessibilite* idx = (IndexAccessibilite*)calloc(1, sizeof(IndexAccessibilite));
+    ResultatSecurite scc = {0};
+    tarjan_scc(g, &scc);
+    idx->nb_sommets     = V;
+    idx->nb_composantes = scc.nb_composantes;
+    idx->composante     = scc.composantes;
+    int C = idx->nb_composantes;
+
+    /* Sommets regroupés par composante (tri par dénombrement) */
+    int* debut_comp = (int*)calloc(C + 2, sizeof(int));
+    int* par_comp   = (int*)malloc((V + 1) * sizeof(int));
+    for (int v = 0; v < V; v++) if (idx->composante[v] >= 0) debut_comp[idx->composante[v] + 2]++;
+    for (int c = 0; c < C; c++) debut_comp[c + 2] += debut_comp[c + 1];
+    for (int v = 0; v < V; v++) if (idx->composante[v] >= 0) par_comp[debut_comp[idx->composante[v] + 1]++] = v;
+
+    /* Arcs du DAG sans doublon : vu[d] = dernière composante source vue */
+    idx->marque = (int*)malloc((C + 1) * sizeof(int));
+    idx->pile   = (int*)malloc((C + 1) * sizeof(int));
+    idx->dag_debut = (int*)malloc((C + 1) * sizeof(int));
+    int capa = 16, nb = 0;
+    idx->dag_succ = (int*)malloc(capa * sizeof(int));
+    for (int c = 0; c < C; c++) idx->marque[c] = -1;
+    for (int c = 0; c < C; c++) {
+        idx->dag_debut[c] = nb;
+        for (int i = debut_comp[c]; i < debut_comp[c + 1]; i++) {
+            for (Arete* a = g->noeuds[par_comp[i]].aretes; a; a = a->suivant) {
+                int d = idx->composante[a->destination];
+                if (d < 0 || d == c || idx->marque[d] == c) continue;
+                idx->marque[d] = c;
+                if (nb == capa) {
+                    capa *= 2;
+                    idx->dag_succ = (int*)realloc(idx->dag_succ, capa * sizeof(int));
+                }
+                idx->dag_succ[nb++] = d;
+            }
+        }
+    }
+    idx->dag_debut[C] = nb;
+    idx->nb_arcs_dag = nb;
+    free(debut_comp);
+    free(par_comp);
+
+    /* Fermeture transitive : les successeurs ont un numéro plus petit */
+    if (max_fermeture <= 0) max_fermeture = INDEX_FERMETURE_MAX;
+    if (C <= max_fermeture) {
+        idx->mots = BITSET_MOTS(C);
+        idx->fermeture = (uint64_t*)calloc((size_t)C * idx->mots + 1, sizeof(uint64_t));
+        for (int c = 0; c < C; c++) {
+            uint64_t* ligne = idx->fermeture + (size_t)c * idx->mots;
+            BITSET_AJOUTER(ligne, c);
+            for (int e = idx->dag_debut[c]; e < idx->dag_debut[c + 1]; e++) {
+                const uint64_t* s = idx->fermeture + (size_t)idx->dag_succ[e] * idx->mots;
+                for (int w = 0; w < idx->mots; w++) ligne[w] |= s[w];
+            }
+        }
+    } else {
+        idx->nb_etiquettes = INDEX_NB_ETIQUETTES;
+        idx->bas  = (int*)malloc((size_t)idx->nb_etiquettes * C * sizeof(int));
+        idx->haut = (int*)malloc((size_t)idx->nb_etiquettes * C * sizeof(int));
+        int* curseur = (int*)malloc((C + 1) * sizeof(int));
+        for (int t = 0; t < idx->nb_etiquettes; t++) etiqueter_grail(idx, t, curseur);
+        free(curseur);
+        for (int c = 0; c < C; c++) idx->marque[c] = 0;
+    }
+    return idx;
+}
+
+void detruire_index_accessibilite(IndexAccessibilite* idx) {
+    if (!idx) return;
+    free(idx->composante); free(idx->dag_debut); free(idx->dag_succ);
+    free(idx->bas); free(idx->haut); free(idx->fermeture);
+    free(idx->marque); free(idx->pile);
+    free(idx);
+}
+
+int peut_atteindre(IndexAccessibilite* idx, int u, int v) {
+    if (!idx || u < 0 || v < 0 || u >= idx->nb_sommets || v >= idx->nb_sommets) return 0;
+    int c = idx->composante[u], d = idx->composante[v];
+    if (c < 0 || d < 0) return 0;
+    if (c == d) return 1;
+    if (idx->fermeture) return BITSET_TEST(idx->fermeture + (size_t)c * idx->mots, d) != 0;
+    if (!accessible_possible(idx, c, d)) return 0;
+    return parcours_elague(idx, c, d);
+}
+
+int zone_peut_atteindre(IndexAccessibilite* idx, const int* zone_a, int nb_a,
+                        const int* zone_b, int nb_b) {
+    if (!idx || nb_a <= 0 || nb_b <= 0) return 0;
+    int C = idx->nb_composantes;
+    if (idx->fermeture) {
+        /* Union des lignes de A, puis test des composantes de B */
+        uint64_t* acc = (uint64_t*)calloc(idx->mots + 1, sizeof(uint64_t));
+        for (int i = 0; i < nb_a; i++) {
+            int c = (zone_a[i] >= 0 && zone_a[i] < idx->nb_sommets) ? idx->composante[zone_a[i]] : -1;
+            if (c < 0) continue;
+            const uint64_t* ligne = idx->fermeture + (size_t)c * idx->mots;
+            for (int w = 0; w < idx->mots; w++) acc[w] |= ligne[w];
+        }
+        int ok = 0;
+        for (int j = 0; j < nb_b && !ok; j++) {
+            int d = (zone_b[j] >= 0 && zone_b[j] < idx->nb_sommets) ? idx->composante[zone_b[j]] : -1;
+            ok = d >= 0 && BITSET_TEST(acc, d);
+        }
+        free(acc);
+        return ok;
+    }
+
+    /* Sans fermeture : un seul parcours depuis toutes les composantes de A */
+    char* cible = (char*)calloc(C + 1, sizeof(char));
+    for (int j = 0; j < nb_b; j++)
+        if (zone_b[j] >= 0 && zone_b[j] < idx->nb_sommets && idx->composante[zone_b[j]] >= 0)
+            cible[idx->composante[zone_b[j]]] = 1;
+    int estampille = ++idx->estampille, h = 0, ok = 0;
+    for (int i = 0; i < nb_a; i++) {
+        int c = (zone_a[i] >= 0 && zone_a[i] < idx->nb_sommets) ? idx->composante[zone_a[i]] : -1;
+        if (c < 0 || idx->marque[c] == estampille) continue;
+        idx->marque[c] = estampille;
+        idx->pile[h++] = c;
+    }
+    while (h > 0 && !ok) {
+        int x = idx->pile[--h];
+        ok = cible[x];
+        for (int e = idx->dag_debut[x]; e < idx->dag_debut[x + 1]; e++) {
+            int y = idx->dag_succ[e];
+            if (idx->marque[y] == estampille) continue;
+            idx->marque[y] = estampille;
+            idx->pile[h++] = y;
+        }
+    }
+    free(cible);
+    return ok;
 }
 
 /* ============================================================
- *  ALGORITHME DE TARJAN : COMPOSANTES FORTEMENT CONNEXES
- *  Complexité : O(V + E)
+ *  CENTRALITÉ D'INTERMÉDIARITÉ (BRANDES PARALLÈLE)
+ *  Pour chaque source s : un plus court chemin (BFS ou Dijkstra sur la
+ *  latence) compte sigma[v], le nombre de plus courts chemins s -> v,
+ *  puis les nœuds sont repris du plus loin au plus proche :
+ *    delta[w] = Σ sigma[w] / sigma[x] * (1 + delta[x])
+ *  sur les arcs w -> x du DAG des plus courts chemins ; chaque terme est
+ *  aussi la part de l'arc w -> x (centralité des liens).
+ *  Les sources sont distribuées par paquets à des threads qui gardent
+ *  chacun leurs accumulateurs et leur espace de travail, remis à zéro
+ *  seulement sur les nœuds atteints ; somme finale en O(W * (V + E)).
+ *  Complexité : O(V * E) non pondéré, O(V * E log V) pondéré
  * ============================================================ */
 
-typedef struct ContextTarjan {
-    const Graphe* g;
-    int*  disc;
-    int*  low;
-    int*  sur_pile;
-    int*  composante; /**< composante[u] = numéro du SCC de u */
-    Pile* pile;
-    int   timer;
-    int   nb_scc;
-} ContextTarjan;
+#define CENTRALITE_PAQUET 16 /* Sources prises d'un coup par un thread */
 
-static void tarjan_dfs(ContextTarjan* ctx, int u) {
-    ctx->disc[u] = ctx->low[u] = ctx->timer++;
-    empiler(ctx->pile, u);
-    ctx->sur_pile[u] = 1;
+typedef struct PartageCentralite {
+    GrapheCSR*       csr;
+    const Graphe*    g;
+    int              mode;
+    atomic_int       prochaine;  /**< Prochaine source à distribuer */
+} PartageCentralite;
 
-    Arete* a = ctx->g->noeuds[u].aretes;
-    while (a) {
-        int v = a->destination;
-        if (ctx->disc[v] == -1) {
-            tarjan_dfs(ctx, v);
-            if (ctx->low[v] < ctx->low[u]) ctx->low[u] = ctx->low[v];
-        } else if (ctx->sur_pile[v]) {
-            if (ctx->disc[v] < ctx->low[u]) ctx->low[u] = ctx->disc[v];
+typedef struct TravailleurCentralite {
+    PartageCentralite* p;
+    double* noeuds;   /**< Accumulateur du thread, par nœud */
+    double* arcs;     /**< Accumulateur du thread, par arc du CSR */
+    double* sigma;
+    double* delta;
+    float*  dist;
+    int*    ordre;    /**< Nœuds dans l'ordre où leur distance est fixée */
+    TasMin* tas;
+} TravailleurCentralite;
+
+/* Plus courts chemins depuis s : remplit ordre, sigma, dist ; retourne le nombre de nœuds atteints */
+static int compter_chemins(TravailleurCentralite* w, int s) {
+    const GrapheCSR* csr = w->p->csr;
+    int pondere = (w->p->mode == CENTRALITE_LATENCE);
+    int n = 0;
+    w->dist[s] = 0.0f;
+    w->sigma[s] = 1.0;
+    if (!pondere) {
+        w->ordre[n++] = s;
+        for (int i = 0; i < n; i++) {
+            int u = w->ordre[i];
+            float du = w->dist[u] + 1.0f;
+            for (int e = csr->debut[u]; e < csr->debut[u + 1]; e++) {
+                int x = csr->voisin[e];
+                if (w->dist[x] == INFINI) { w->dist[x] = du; w->ordre[n++] = x; }
+                if (w->dist[x] == du) w->sigma[x] += w->sigma[u];
+            }
         }
-        a = a->suivant;
+        return n;
     }
+    /* Dijkstra paresseux : un nœud est fixé à sa première sortie du tas */
+    tas_vider(w->tas);
+    tas_inserer(w->tas, s, 0.0f);
+    while (!tas_vide(w->tas)) {
+        float cle;
+        int u = tas_extraire_min(w->tas, &cle);
+        if (cle > w->dist[u] || w->delta[u] < 0.0) continue;
+        w->delta[u] = -1.0; /* Fixé (delta est remis à 0 avant la remontée) */
+        w->ordre[n++] = u;
+        for (int e = csr->debut[u]; e < csr->debut[u + 1]; e++) {
+            int x = csr->voisin[e];
+            float nd = w->dist[u] + csr->latence[e];
+            if (nd < w->dist[x]) {
+                w->dist[x] = nd;
+                w->sigma[x] = w->sigma[u];
+                tas_inserer(w->tas, x, nd);
+            } else if (nd == w->dist[x] && w->delta[x] >= 0.0) {
+                w->sigma[x] += w->sigma[u];
+            }
+        }
+    }
+    return n;
+}
+
+static void accumuler_source(TravailleurCentralite* w, int s) {
+    const GrapheCSR* csr = w->p->csr;
+    int pondere = (w->p->mode == CENTRALITE_LATENCE);
+    int n = compter_chemins(w, s);
+    for (int i = 0; i < n; i++) w->delta[w->ordre[i]] = 0.0;
 
-    /* Racine d'un SCC */
-    if (ctx->low[u] == ctx->disc[u]) {
-        int v;
-        do {
-            v = depiler(ctx->pile);
-            ctx->sur_pile[v] = 0;
-            ctx->composante[v] = ctx->nb_scc;
-        } while (v != u);
-        ctx->nb_scc++;
+    for (int i = n - 1; i >= 0; i--) {
+        int u = w->ordre[i];
+        double d = 0.0;
+        for (int e = csr->debut[u]; e < csr->debut[u + 1]; e++) {
+            int x = csr->voisin[e];
+            float longueur = pondere ? csr->latence[e] : 1.0f;
+            if (w->dist[x] == INFINI || w->dist[x] != w->dist[u] + longueur || x == s) continue;
+            double part = w->sigma[u] / w->sigma[x] * (1.0 + w->delta[x]);
+            w->arcs[e] += part;
+            d += part;
+        }
+        w->delta[u] = d;
+        if (u != s) w->noeuds[u] += d;
+    }
+    /* Espace de travail rendu propre pour la source suivante */
+    for (int i = 0; i < n; i++) {
+        int u = w->ordre[i];
+        w->dist[u] = INFINI;
+        w->sigma[u] = 0.0;
+        w->delta[u] = 0.0;
     }
 }
 
-void tarjan_scc(const Graphe* g, ResultatSecurite* res) {
+static void* worker_centralite(void* arg) {
+    TravailleurCentralite* w = (TravailleurCentralite*)arg;
+    PartageCentralite* p = w->p;
+    int V = p->csr->nb_noeuds;
+    for (;;) {
+        int debut = atomic_fetch_add(&p->prochaine, CENTRALITE_PAQUET);
+        if (debut >= V) break;
+        int fin = debut + CENTRALITE_PAQUET < V ? debut + CENTRALITE_PAQUET : V;
+        for (int s = debut; s < fin; s++)
+            if (p->g->noeuds[s].actif) accumuler_source(w, s);
+    }
+    return NULL;
+}
+
+/* Classements décroissants (égalités : plus petit identifiant d'abord) */
+typedef struct EntreeCentralite {
+    double valeur;
+    int    src;
+    int    dest;
+} EntreeCentralite;
+
+static int cmp_lien_cle(const void* a, const void* b) {
+    const EntreeCentralite* x = (const EntreeCentralite*)a;
+    const EntreeCentralite* y = (const EntreeCentralite*)b;
+    if (x->src != y->src) return x->src < y->src ? -1 : 1;
+    return (x->dest > y->dest) - (x->dest < y->dest);
+}
+
+static int cmp_centralite_decroissante(const void* a, const void* b) {
+    const EntreeCentralite* x = (const EntreeCentralite*)a;
+    const EntreeCentralite* y = (const EntreeCentralite*)b;
+    if (x->valeur != y->valeur) return x->valeur > y->valeur ? -1 : 1;
+    return cmp_lien_cle(a, b);
+}
+
+ResultatCentralite* centralite_intermediarite(const Graphe* g, int mode, int nb_threads) {
+    if (!g) return NULL;
+    double t0 = temps_ms();
     int V = g->capacite_max;
-    ContextTarjan ctx;
-    ctx.g          = g;
-    ctx.disc       = (int*)malloc(V * sizeof(int));
-    ctx.low        = (int*)malloc(V * sizeof(int));
-    ctx.sur_pile   = (int*)calloc(V, sizeof(int));
-    ctx.composante = (int*)malloc(V * sizeof(int));
-    ctx.pile       = creer_pile();
-    ctx.timer      = 0;
-    ctx.nb_scc     = 0;
-
-    for (int i = 0; i < V; i++) { ctx.disc[i] = -1; ctx.composante[i] = -1; }
+    PartageCentralite p;
+    p.csr  = construire_csr(g, 0, NULL);
+    p.g    = g;
+    p.mode = mode;
+    atomic_init(&p.prochaine, 0);
+    int E = p.csr->nb_arcs;
 
-    for (int i = 0; i < V; i++)
-        if (g->noeuds[i].actif && ctx.disc[i] == -1) tarjan_dfs(&ctx, i);
+    int W = nb_threads > 0 ? nb_threads : nb_threads_disponibles();
+    if (W > V) W = V > 0 ? V : 1;
+    TravailleurCentralite* w = (TravailleurCentralite*)malloc(W * sizeof(TravailleurCentralite));
+    for (int i = 0; i < W; i++) {
+        w[i].p      = &p;
+        w[i].noeuds = (double*)calloc(V + 1, sizeof(double));
+        w[i].arcs   = (double*)calloc(E + 1, sizeof(double));
+        w[i].sigma  = (double*)calloc(V + 1, sizeof(double));
+        w[i].delta  = (double*)calloc(V + 1, sizeof(double));
+        w[i].dist   = (float*)malloc((V + 1) * sizeof(float));
+        w[i].ordre  = (int*)malloc((V + 1) * sizeof(int));
+        w[i].tas    = mode == CENTRALITE_LATENCE ? creer_tas(V + 1) : NULL;
+        for (int v = 0; v < V; v++) w[i].dist[v] = INFINI;
+    }
+    executer_en_parallele(worker_centralite, w, sizeof(TravailleurCentralite), W);
+
+    /* Somme des accumulateurs ; non orienté : chaque paire compte deux fois */
+    double facteur = g->est_oriente ? 1.0 : 0.5;
+    for (int i = 1; i < W; i++) {
+        for (int v = 0; v < V; v++) w[0].noeuds[v] += w[i].noeuds[v];
+        for (int e = 0; e < E; e++) w[0].arcs[e] += w[i].arcs[e];
+    }
 
-    res->composantes    = ctx.composante;
-    res->nb_composantes = ctx.nb_scc;
+    ResultatCentralite* rc = (ResultatCentralite*)calloc(1, sizeof(ResultatCentralite));
+    rc->nb_noeuds = V;
+    rc->noeuds = (double*)malloc((V + 1) * sizeof(double));
+    EntreeCentralite* tri = (EntreeCentralite*)malloc((V > E ? V : E) * sizeof(EntreeCentralite) + 1);
+    int n = 0;
+    for (int v = 0; v < V; v++) {
+        rc->noeuds[v] = w[0].noeuds[v] * facteur;
+        if (!g->noeuds[v].actif) continue;
+        tri[n].valeur = rc->noeuds[v];
+        tri[n].src = v; tri[n].dest = v;
+        n++;
+    }
+    qsort(tri, n, sizeof(EntreeCentralite), cmp_centralite_decroissante);
+    rc->classement = (int*)malloc((n + 1) * sizeof(int));
+    rc->nb_classes = n;
+    for (int i = 0; i < n; i++) rc->classement[i] = tri[i].src;
 
-    free(ctx.disc); free(ctx.low); free(ctx.sur_pile);
-    detruire_pile(ctx.pile);
+    /* Liens : arcs parallèles (et les deux sens en non orienté) réunis */
+    n = 0;
+    for (int u = 0; u < V; u++) {
+        for (int e = p.csr->debut[u]; e < p.csr->debut[u + 1]; e++) {
+            int x = p.csr->voisin[e];
+            tri[n].valeur = w[0].arcs[e];
+            tri[n].src  = (g->est_oriente || u < x) ? u : x;
+            tri[n].dest = (g->est_oriente || u < x) ? x : u;
+            n++;
+        }
+    }
+    qsort(tri, n, sizeof(EntreeCentralite), cmp_lien_cle);
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        if (m > 0 && tri[m - 1].src == tri[i].src && tri[m - 1].dest == tri[i].dest)
+            tri[m - 1].valeur += tri[i].valeur;
+        else tri[m++] = tri[i];
+    }
+    for (int i = 0; i < m; i++) tri[i].valeur *= facteur;
+    qsort(tri, m, sizeof(EntreeCentralite), cmp_centralite_decroissante);
+    rc->nb_liens = m;
+    rc->liens = (int*)malloc((2 * m + 1) * sizeof(int));
+    rc->centralite_liens = (double*)malloc((m + 1) * sizeof(double));
+    for (int i = 0; i < m; i++) {
+        rc->liens[2 * i] = tri[i].src;
+        rc->liens[2 * i + 1] = tri[i].dest;
+        rc->centralite_liens[i] = tri[i].valeur;
+    }
+    free(tri);
+
+    for (int i = 0; i < W; i++) {
+        free(w[i].noeuds); free(w[i].arcs); free(w[i].sigma); free(w[i].delta);
+        free(w[i].dist); free(w[i].ordre);
+        if (w[i].tas) detruire_tas(w[i].tas);
+    }
+    free(w);
+    detruire_csr(p.csr);
+    rc->temps_ms = temps_ms() - t0;
+    return rc;
+}
+
+void detruire_centralite(ResultatCentralite* rc) {
+    if (!rc) return;
+    free(rc->noeuds); free(rc->classement);
+    free(rc->liens); free(rc->centralite_liens);
+    free(rc);
+}
+
+/* ============================================================
+ *  FONCTION DE VOISINAGE APPROCHÉE (HYPERANF)
+ *  Chaque nœud v porte un compteur HyperLogLog de l'ensemble des nœuds
+ *  qu'il atteint en au plus t sauts. Itération t + 1 :
+ *    c(v) <- c(v) ∪ c(w) pour chaque arc v -> w
+ *  (union = maximum registre par registre). N(t) = Σ |c(v)| estime le
+ *  nombre de paires à distance <= t ; on s'arrête quand plus aucun
+ *  compteur ne change. Les registres (8 bits, valeurs < 128) sont rangés
+ *  par 8 dans des mots de 64 bits : le maximum se calcule sur 8 registres
+ *  à la fois, sans branchement. Un nœud dont aucun successeur n'a changé
+ *  au tour précédent est simplement recopié.
+ *  Complexité : O(D * (V + E) * m / 8) pour D itérations, m registres
+ * ============================================================ */
+
+#define VOISINAGE_OCTETS_HAUTS  UINT64_C(0x8080808080808080)
+#define VOISINAGE_NOEUDS_THREAD 256 /* En dessous : pas de thread en plus */
+
+/* Maximum octet par octet de deux mots (octets < 0x80) */
+static uint64_t max_octets(uint64_t x, uint64_t y) {
+    uint64_t ge = (((x | VOISINAGE_OCTETS_HAUTS) - y) & VOISINAGE_OCTETS_HAUTS) >> 7;
+    uint64_t masque = ge * 0xFF; /* 0xFF là où x >= y */
+    return (x & masque) | (y & ~masque);
+}
+
+static uint64_t melanger_64(uint64_t x) {
+    x += UINT64_C(0x9E3779B97F4A7C15);
+    x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+
+typedef struct EtapeVoisinage {
+    const GrapheCSR* csr;
+    const char*      actif;
+    const uint64_t*  courant;
+    uint64_t*        suivant;
+    const char*      modifie;     /**< Compteurs changés au tour précédent */
+    char*            modifie_suivant;
+    const double*    taille;      /**< Estimation |c(v)| au tour précédent */
+    double*          taille_suivante;
+    const double*    puissances;  /**< 2^-r */
+    int              mots;        /**< Mots de 64 bits par compteur */
+    int              nb_registres;
+    int              debut, fin;
+} EtapeVoisinage;
+
+static double estimer_compteur(const EtapeVoisinage* t, const uint64_t* c) {
+    const uint8_t* r = (const uint8_t*)c;
+    int m = t->nb_registres, zeros = 0;
+    double somme = 0.0;
+    for (int j = 0; j < m; j++) {
+        somme += t->puissances[r[j]];
+        zeros += (r[j] == 0);
+    }
+    double alpha = m == 16 ? 0.673 : m == 32 ? 0.697 : m == 64 ? 0.709 : 0.7213 / (1.0 + 1.079 / m);
+    double e = alpha * m * m / somme;
+    if (e <= 2.5 * m && zeros > 0) e = m * log((double)m / zeros); /* Petits ensembles */
+    return e;
+}
+
+static void* etape_voisinage(void* arg) {
+    EtapeVoisinage* t = (EtapeVoisinage*)arg;
+    const GrapheCSR* csr = t->csr;
+    int M = t->mots;
+    for (int v = t->debut; v < t->fin; v++) {
+        const uint64_t* ancien = t->courant + (size_t)v * M;
+        uint64_t* nouveau = t->suivant + (size_t)v * M;
+        memcpy(nouveau, ancien, M * sizeof(uint64_t));
+        t->modifie_suivant[v] = 0;
+        t->taille_suivante[v] = t->taille[v];
+        if (!t->actif[v]) continue;
+
+        int a_refaire = 0;
+        for (int e = csr->debut[v]; e < csr->debut[v + 1] && !a_refaire; e++)
+            a_refaire = t->modifie[csr->voisin[e]];
+        if (!a_refaire) continue;
+
+        for (int e = csr->debut[v]; e < csr->debut[v + 1]; e++) {
+            const uint64_t* c = t->courant + (size_t)csr->voisin[e] * M;
+            for (int k = 0; k < M; k++) nouveau[k] = max_octets(nouveau[k], c[k]);
+        }
+        if (memcmp(nouveau, ancien, M * sizeof(uint64_t)) == 0) continue;
+        t->modifie_suivant[v] = 1;
+        double e = estimer_compteur(t, nouveau);
+        if (e > t->taille[v]) t->taille_suivante[v] = e; /* Jamais décroissant */
+    }
+    return NULL;
+}
+
+ResultatVoisinage* estimer_voisinage(const Graphe* g, int log2_registres, int nb_threads) {
+    if (!g) return NULL;
+    double t0 = temps_ms();
+    if (log2_registres <= 0) log2_registres = VOISINAGE_LOG2_REGISTRES;
+    if (log2_registres < 4) log2_registres = 4;
+    if (log2_registres > 12) log2_registres = 12;
+    int V = g->capacite_max;
+    int b = log2_registres, m = 1 << b, M = m / 8;
+    GrapheCSR* csr = construire_csr(g, 0, NULL);
+
+    uint64_t* courant = (uint64_t*)calloc((size_t)V * M + 1, sizeof(uint64_t));
+    uint64_t* suivant = (uint64_t*)calloc((size_t)V * M + 1, sizeof(uint64_t));
+    char*   actif     = (char*)calloc(V + 1, 1);
+    char*   modifie   = (char*)calloc(V + 1, 1);
+    char*   modifie_s = (char*)calloc(V + 1, 1);
+    double* taille    = (double*)calloc(V + 1, sizeof(double));
+    double* taille_s  = (double*)calloc(V + 1, sizeof(double));
+    double* distances = (double*)calloc(V + 1, sizeof(double)); /* Σ t * nouveaux(t) */
+    double  puissances[65];
+    for (int r = 0; r <= 64; r++) puissances[r] = ldexp(1.0, -r);
+
+    ResultatVoisinage* rv = (ResultatVoisinage*)calloc(1, sizeof(ResultatVoisinage));
+    rv->nb_noeuds    = V;
+    rv->nb_registres = m;
+    rv->proximite    = (double*)calloc(V + 1, sizeof(double));
+    rv->harmonique   = (double*)calloc(V + 1, sizeof(double));
+    int capa = 16;
+    rv->fonction = (double*)malloc(capa * sizeof(double));
+
+    /* t = 0 : chaque compteur ne contient que son nœud */
+    EtapeVoisinage modele = { csr, actif, NULL, NULL, NULL, NULL, NULL, NULL, puissances, M, m, 0, 0 };
+    double n0 = 0.0;
+    for (int v = 0; v < V; v++) {
+        if (!g->noeuds[v].actif) continue;
+        actif[v] = modifie[v] = 1;
+        uint64_t h = melanger_64((uint64_t)v);
+        int j = (int)(h >> (64 - b));
+        uint64_t reste = (h << b) | (UINT64_C(1) << (b - 1)); /* Rang borné */
+        ((uint8_t*)(courant + (size_t)v * M))[j] = (uint8_t)(__builtin_clzll(reste) + 1);
+        taille[v] = estimer_compteur(&modele, courant + (size_t)v * M);
+        n0 += taille[v];
+    }
+    rv->fonction[0] = n0;
+
+    int W_max = nb_threads > 0 ? nb_threads : nb_threads_disponibles();
+    int W = V / VOISINAGE_NOEUDS_THREAD > 1 ? V / VOISINAGE_NOEUDS_THREAD : 1;
+    if (W > W_max) W = W_max;
+    if (W > 64) W = 64;
+    EtapeVoisinage etapes[64];
+
+    int t = 0, change = 1;
+    while (change && t < V) {
+        int part = (V + W - 1) / W;
+        for (int i = 0; i < W; i++) {
+            etapes[i] = modele;
+            etapes[i].courant = courant;         etapes[i].suivant = suivant;
+            etapes[i].modifie = modifie;         etapes[i].modifie_suivant = modifie_s;
+            etapes[i].taille  = taille;          etapes[i].taille_suivante = taille_s;
+            etapes[i].debut = i * part < V ? i * part : V;
+            etapes[i].fin   = (i + 1) * part < V ? (i + 1) * part : V;
+        }
+        executer_en_parallele(etape_voisinage, etapes, sizeof(EtapeVoisinage), W);
+
+        /* Bilan du tour t + 1 (séquentiel : résultat indépendant de W) */
+        t++;
+        change = 0;
+        double nt = 0.0;
+        for (int v = 0; v < V; v++) {
+            nt += taille_s[v];
+            double nouveaux = taille_s[v] - taille[v];
+            if (modifie_s[v]) change = 1;
+            if (nouveaux <= 0.0) continue;
+            distances[v] += t * nouveaux;
+            rv->harmonique[v] += nouveaux / t;
+        }
+        if (!change) { t--; break; }
+        if (t == capa) {
+            capa *= 2;
+            rv->fonction = (double*)realloc(rv->fonction, capa * sizeof(double));
+        }
+        rv->fonction[t] = nt;
+        uint64_t* x = courant; courant = suivant; suivant = x;
+        char* y = modifie; modifie = modifie_s; modifie_s = y;
+        double* z = taille; taille = taille_s; taille_s = z;
+    }
+    rv->nb_iterations = t;
+
+    /* Mesures globales sur les paires à distance >= 1 */
+    double paires = rv->fonction[t] - rv->fonction[0];
+    rv->paires_atteignables = paires;
+    if (paires > 0.0) {
+        double somme = 0.0, seuil = VOISINAGE_CENTILE * paires;
+        for (int k = 1; k <= t; k++) somme += k * (rv->fonction[k] - rv->fonction[k - 1]);
+        rv->distance_moyenne = somme / paires;
+        for (int k = 1; k <= t; k++) {
+            double avant = rv->fonction[k - 1] - rv->fonction[0];
+            double apres = rv->fonction[k] - rv->fonction[0];
+            if (apres < seuil) continue;
+            rv->diametre_effectif = (k - 1) + (apres > avant ? (seuil - avant) / (apres - avant) : 1.0);
+            break;
+        }
+    }
+    for (int v = 0; v < V; v++)
+        if (distances[v] > 0.0) rv->proximite[v] = (taille[v] - 1.0 > 0.0 ? taille[v] - 1.0 : 0.0) / distances[v];
+
+    free(courant); free(suivant); free(actif); free(modifie); free(modifie_s);
+    free(taille); free(taille_s); free(distances);
+    detruire_csr(csr);
+    rv->temps_ms = temps_ms() - t0;
+    return rv;
+}
+
+void detruire_voisinage(ResultatVoisinage* rv) {
+    if (!rv) return;
+    free(rv->fonction); free(rv->proximite); free(rv->harmonique);
+    free(rv);
+}
+
+void afficher_voisinage(const ResultatVoisinage* rv, const Graphe* g) {
+    int actifs = 0;
+    for (int v = 0; v < rv->nb_noeuds; v++) actifs += g->noeuds[v].actif;
+    printf("\nSanté du réseau (HyperANF, %d registres par nœud) :\n", rv->nb_registres);
+    printf("  Paires reliées       : ~%.0f sur %.0f\n",
+           rv->paires_atteignables, (double)actifs * (actifs - 1));
+    printf("  Distance moyenne     : %.2f saut(s)\n", rv->distance_moyenne);
+    printf("  Diamètre effectif    : %.2f saut(s) (%.0f %% des paires)\n",
+           rv->diametre_effectif, VOISINAGE_CENTILE * 100.0);
+    printf("  Diamètre (≈)         : %d saut(s)\n", rv->nb_iterations);
+
+    /* Proximité harmonique : tient compte de la part du réseau atteinte,
+     * contrairement à la closeness. Sélection des k premiers (k petit). */
+    char* pris = (char*)calloc(rv->nb_noeuds + 1, 1);
+    printf("  Nœuds les plus proches du reste du réseau (Σ 1/d) :\n");
+    for (int k = 0; k < RAPPORT_NB_CENTRAUX; k++) {
+        int meilleur = -1;
+        for (int v = 0; v < rv->nb_noeuds; v++)
+            if (!pris[v] && rv->harmonique[v] > 0.0 &&
+                (meilleur < 0 || rv->harmonique[v] > rv->harmonique[meilleur])) meilleur = v;
+        if (meilleur < 0) break;
+        pris[meilleur] = 1;
+        printf("  %2d. Nœud %-4d - %-20s %8.2f (closeness %.3f)\n", k + 1, meilleur,
+               g->noeuds[meilleur].nom, rv->harmonique[meilleur], rv->proximite[meilleur]);
+    }
+    free(pris);
+    printf("  Estimation : %.3f ms\n", rv->temps_ms);
 }
 
 /* ============================================================
@@ -250,9 +1644,31 @@ ResultatSecurite* analyser_securite(const Graphe* g) {
     ResultatSecurite* res = (ResultatSecurite*)calloc(1, sizeof(ResultatSecurite));
 
     printf("\n[ANALYSE DE SÉCURITÉ EN COURS...]\n");
-    res->a_cycle = detecter_cycle(g);
-    trouver_points_articulation(g, res);
-    tarjan_scc(g, res);
+    double t0 = temps_ms();
+    ContextSecurite ctx;
+    init_context_securite(&ctx, g);
+    double t1 = temps_ms();
+    parcourir_securite(&ctx);
+    double t2 = temps_ms();
+    res->a_cycle = ctx.a_cycle;
+    collecter_articulations(&ctx, res);
+    collecter_ponts(&ctx, res);
+    collecter_composantes(&ctx, res);
+    liberer_context_securite(&ctx);
+    double t3 = temps_ms();
+
+    res->temps_init_ms     = t1 - t0;
+    res->temps_parcours_ms = t2 - t1;
+    res->temps_collecte_ms = t3 - t2;
+    return res;
+}
+
+ResultatSecurite* analyser_securite_approfondie(const Graphe* g) {
+    ResultatSecurite* res = analyser_securite(g);
+    /* Au-delà des points d'articulation : routeurs et liens les plus
+       traversés, puis santé globale (distances, diamètre effectif) */
+    res->centralite = centralite_intermediarite(g, CENTRALITE_LATENCE, 0);
+    res->voisinage  = estimer_voisinage(g, 0, 0);
     return res;
 }
 
@@ -269,18 +1685,48 @@ void afficher_resultats_securite(const ResultatSecurite* res, const Graphe* g) {
     printf("\nPonts (arêtes critiques) (%d) :\n", res->nb_ponts);
     for (int i = 0; i < res->nb_ponts; i++)
         printf("  [PONT] %s -> %s\n",
-               g->noeuds[res->ponts[i][0]].nom,
-               g->noeuds[res->ponts[i][1]].nom);
+               g->noeuds[res->ponts[2 * i]].nom,
+               g->noeuds[res->ponts[2 * i + 1]].nom);
 
     printf("\nComposantes Fortement Connexes : %d sous-réseau(x)\n",
            res->nb_composantes);
+
+    const ResultatCentralite* rc = res->centralite;
+    if (rc) {
+        int nb = rc->nb_classes < RAPPORT_NB_CENTRAUX ? rc->nb_classes : RAPPORT_NB_CENTRAUX;
+        printf("\nNœuds les plus traversés (intermédiarité, latence) :\n");
+        for (int i = 0; i < nb && rc->noeuds[rc->classement[i]] > 0.0; i++)
+            printf("  %2d. Nœud %-4d - %-20s %12.1f\n", i + 1, rc->classement[i],
+                   g->noeuds[rc->classement[i]].nom, rc->noeuds[rc->classement[i]]);
+        nb = rc->nb_liens < RAPPORT_NB_CENTRAUX ? rc->nb_liens : RAPPORT_NB_CENTRAUX;
+        printf("\nLiens les plus traversés :\n");
+        for (int i = 0; i < nb && rc->centralite_liens[i] > 0.0; i++)
+            printf("  %2d. %s %s %s %12.1f\n", i + 1,
+                   g->noeuds[rc->liens[2 * i]].nom, g->est_oriente ? "->" : "--",
+                   g->noeuds[rc->liens[2 * i + 1]].nom, rc->centralite_liens[i]);
+    }
+
+    double total = res->temps_init_ms + res->temps_parcours_ms + res->temps_collecte_ms;
+    if (rc) total += rc->temps_ms;
+    if (res->voisinage) total += res->voisinage->temps_ms;
+    if (total > 0.0) {
+        printf("\nDurée : %.3f ms (init %.3f, parcours %.3f, collecte %.3f",
+               total, res->temps_init_ms, res->temps_parcours_ms,
+               res->temps_collecte_ms);
+        if (rc) printf(", centralité %.3f", rc->temps_ms);
+        if (res->voisinage) printf(", voisinage %.3f", res->voisinage->temps_ms);
+        printf(")\n");
+    }
+    if (res->voisinage)
+        afficher_voisinage(res->voisinage, g);
 }
 
 void detruire_resultat_securite(ResultatSecurite* res) {
     if (!res) return;
     free(res->points_articulation);
-    for (int i = 0; i < res->nb_ponts; i++) free(res->ponts[i]);
     free(res->ponts);
     free(res->composantes);
+    detruire_centralite(res->centralite);
+    detruire_voisinage(res->voisinage);
     free(res);
 }
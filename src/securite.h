@@ -6,6 +6,7 @@
 #ifndef SECURITE_H
 #define SECURITE_H
 
+#include <stdint.h>
 #include "interfaces.h"
 #include "graphe.h"
 
@@ -21,7 +22,8 @@
 void dfs(const Graphe* g, int depart, int* ordre, int* nb_visites);
 
 /**
- * @brief Parcours en largeur (BFS)
+ * @brief Parcours en largeur (BFS), moteur parcours_largeur (graphe.h) en
+ *        séquentiel ; appeler parcours_largeur pour répartir entre threads
  * @complexity O(V + E)
  */
 void bfs(const Graphe* g, int depart, int* ordre, int* nb_visites);
@@ -38,37 +40,254 @@ int detecter_cycle(const Graphe* g);
 /* --- Points d'articulation & Ponts --- */
 
 /**
- * @brief Trouve tous les points d'articulation (nœuds critiques)
+ * @brief Trouve tous les points d'articulation (nœuds critiques) et les ponts
  * @param g   Graphe
- * @param res Structure résultat à remplir
+ * @param res Structure résultat à remplir (points_articulation, ponts)
  * @complexity O(V + E) - DFS modifié avec tableau low[]
  */
 void trouver_points_articulation(const Graphe* g, ResultatSecurite* res);
 
 /**
  * @brief Trouve tous les ponts (arêtes critiques)
+ * @param res Structure résultat : ponts (paires à plat) et nb_ponts
  * @complexity O(V + E)
  */
 void trouver_ponts(const Graphe* g, ResultatSecurite* res);
 
+/* --- Arbre des blocs : impact d'une panne de nœud --- */
+
+/**
+ * @brief Arbre des blocs et des points d'articulation (block-cut tree)
+ *
+ * Nœuds 0..nb_blocs-1 : blocs (composantes biconnexes) ; les suivants :
+ * un par point d'articulation, relié à chaque bloc qui le contient. Une
+ * composante connexe donne un arbre. L'index est construit sur la vue non
+ * orientée du réseau (u et v sont voisins dès qu'un arc existe entre eux,
+ * dans un sens ou dans l'autre), comme securite_dynamique.h : sur un graphe
+ * orienté, connexité et pannes s'entendent au sens faible.
+ */
+typedef struct ArbreBlocs {
+    int  nb_sommets;        /**< capacite_max du graphe */
+    int  nb_blocs;
+    int  nb_noeuds_arbre;   /**< Blocs + points d'articulation */
+    int* bloc_debut;        /**< nb_blocs + 1 entrées */
+    int* bloc_sommets;      /**< Sommets de chaque bloc, à plat */
+    int* noeud_de;          /**< Nœud portant chaque sommet (-1 : inactif) */
+    /* Arbre enraciné (racine = plus petit nœud de chaque arbre) */
+    int* parent;
+    int* profondeur;
+    int* racine;
+    int* entree;            /**< Rang préfixe ; sous-arbre = [entree, fin) */
+    int* fin;
+    int* enfants_debut;     /**< Enfants de chaque nœud, dans l'ordre préfixe */
+    int* enfants;
+    /* Sommets dans l'ordre préfixe : sous-arbre = [premier_sommet, fin_sommets) */
+    int* ordre_sommets;
+    int* premier_sommet;
+    int* fin_sommets;
+    /* Ancêtre commun : tour d'Euler + table creuse */
+    int* euler;
+    int  taille_euler;
+    int* premiere;          /**< Première position de chaque nœud dans le tour */
+    int* table_euler;       /**< nb_niveaux_euler x taille_euler */
+    int  nb_niveaux_euler;
+} ArbreBlocs;
+
+/**
+ * @brief Construit l'arbre des blocs : un parcours de Tarjan-Hopcroft sur
+ *        la liste d'adjacence symétrisée (blocs collectés au passage)
+ * @complexity O(V + E) + O(V log V) pour la table des ancêtres communs
+ */
+ArbreBlocs* construire_arbre_blocs(const Graphe* g);
+
+void detruire_arbre_blocs(ArbreBlocs* ab);
+
+/**
+ * @brief u et v restent-ils reliés si le nœud panne tombe ?
+ * @param panne Nœud en panne (-1 = aucune : simple test de connexité)
+ * @return 1 si reliés, 0 sinon (ou si u ou v est le nœud en panne)
+ * @complexity O(1)
+ */
+int connectes_apres_panne(const ArbreBlocs* ab, int u, int v, int panne);
+
+/**
+ * @brief Nœuds reliés au cœur avant la panne et coupés de lui après
+ * @param sortie Nœuds concernés (au moins capacite_max cases, peut être NULL)
+ * @return Nombre de nœuds coupés, -1 si panne ou coeur invalide ou égaux
+ * @complexity O(log V) + taille de la sortie
+ */
+int sommets_isoles_par_panne(const ArbreBlocs* ab, int panne, int coeur, int* sortie);
+
 /* --- Composantes Fortement Connexes (Tarjan) --- */
 
 /**
  * @brief Algorithme de Tarjan pour les SCC
+ * @details Composantes numérotées dans l'ordre topologique inverse du
+ *          graphe condensé : un arc entre composantes va toujours d'un
+ *          numéro plus grand vers un plus petit (construire_index_accessibilite
+ *          s'appuie sur cet ordre).
  * @param g   Graphe orienté
  * @param res Structure résultat à remplir
  * @complexity O(V + E)
  */
 void tarjan_scc(const Graphe* g, ResultatSecurite* res);
 
+/**
+ * @brief SCC multi-threadées (avant-arrière avec élagage), alternative à
+ *        tarjan_scc pour les grands graphes orientés
+ *
+ * Même partition et même nb_composantes que tarjan_scc ; les composantes
+ * sont numérotées dans l'ordre de leur plus petit nœud (indépendant du
+ * nombre de threads), -1 pour les nœuds inactifs.
+ *
+ * Attention : cette numérotation n'est PAS un ordre topologique. Un code
+ * qui parcourt le graphe condensé dans l'ordre des numéros (fermeture,
+ * accessibilité, tri du DAG) doit utiliser tarjan_scc.
+ *
+ * @param nb_threads Nombre de threads (0 = nombre de coeurs)
+ * @complexity O((V + E) * profondeur de découpage), O(V + E) en pratique
+ */
+void scc_parallele(const Graphe* g, ResultatSecurite* res, int nb_threads);
+
+/* --- Accessibilité : graphe des composantes indexé --- */
+
+#define INDEX_FERMETURE_MAX 8192  /**< Au-delà : étiquettes GRAIL, pas de fermeture */
+#define INDEX_NB_ETIQUETTES 3     /**< Parcours GRAIL (intervalles par composante) */
+
+/**
+ * @brief Index « u peut-il atteindre v ? » construit sur le graphe des
+ *        composantes (DAG des SCC de tarjan_scc)
+ *
+ * Les SCC gardent la numérotation de Tarjan : un arc du DAG va toujours
+ * vers un numéro plus petit. Jusqu'à max_fermeture composantes, la
+ * fermeture transitive est stockée en bits (C² / 8 octets) ; au-delà,
+ * chaque composante reçoit INDEX_NB_ETIQUETTES intervalles GRAIL et les
+ * requêtes non tranchées par les filtres finissent par un parcours élagué.
+ */
+typedef struct IndexAccessibilite {
+    int  nb_sommets;        /**< capacite_max du graphe */
+    int  nb_composantes;
+    int* composante;        /**< SCC de chaque sommet (-1 : inactif) */
+    int* dag_debut;         /**< Successeurs de chaque SCC (nb_composantes + 1) */
+    int* dag_succ;
+    int  nb_arcs_dag;
+    /* Fermeture transitive (NULL si trop de composantes) */
+    uint64_t* fermeture;    /**< nb_composantes lignes de mots bits */
+    int  mots;
+    /* Étiquettes GRAIL : c atteint d => [bas[d], haut[d]] ⊂ [bas[c], haut[c]] */
+    int  nb_etiquettes;
+    int* bas;               /**< nb_etiquettes x nb_composantes */
+    int* haut;              /**< Rang postfixe */
+    /* Travail des parcours de secours */
+    int* marque;
+    int  estampille;
+    int* pile;
+} IndexAccessibilite;
+
+/**
+ * @brief Construit l'index (un tarjan_scc puis le DAG sans arcs doubles)
+ * @param max_fermeture Nombre maximal de SCC pour la fermeture en bits
+ *                      (0 = INDEX_FERMETURE_MAX)
+ * @complexity O(V + E) + O(E_dag * C / 64) avec fermeture,
+ *             O(V + E + k * (C + E_dag)) sinon
+ */
+IndexAccessibilite* construire_index_accessibilite(const Graphe* g, int max_fermeture);
+
+void detruire_index_accessibilite(IndexAccessibilite* idx);
+
+/**
+ * @brief 1 si un chemin orienté mène de u à v (u atteint toujours u)
+ * @complexity O(1) avec fermeture ; sinon O(k) pour les réponses
+ *             tranchées par les étiquettes, parcours élagué pour les autres
+ */
+int peut_atteindre(IndexAccessibilite* idx, int u, int v);
+
+/**
+ * @brief 1 si un nœud de la zone A atteint un nœud de la zone B
+ * @complexity O(|A| * C / 64 + |B|) avec fermeture, O(C + E_dag) sinon
+ */
+int zone_peut_atteindre(IndexAccessibilite* idx, const int* zone_a, int nb_a,
+                        const int* zone_b, int nb_b);
+
+/* --- Centralité d'intermédiarité --- */
+
+#define CENTRALITE_NON_PONDEREE 0  /**< Plus courts chemins en nombre de sauts */
+#define CENTRALITE_LATENCE      1  /**< Plus courts chemins en latence */
+#define RAPPORT_NB_CENTRAUX     10 /**< Lignes du classement dans le rapport */
+
+/**
+ * @brief Centralité d'intermédiarité des nœuds et des liens (Brandes)
+ *
+ * Repère les routeurs et les liens par lesquels passe le plus de trafic
+ * au plus court, au-delà des seuls points de rupture. Les sources sont
+ * réparties entre threads, chacun avec ses accumulateurs et un espace de
+ * travail réutilisé d'une source à l'autre.
+ *
+ * @param mode       CENTRALITE_NON_PONDEREE ou CENTRALITE_LATENCE
+ * @param nb_threads Nombre de threads (0 = nombre de coeurs)
+ * @return Résultat alloué (detruire_centralite), NULL si g est NULL
+ * @complexity O(V * E) non pondéré, O(V * E log V) en latence
+ */
+ResultatCentralite* centralite_intermediarite(const Graphe* g, int mode, int nb_threads);
+
+void detruire_centralite(ResultatCentralite* rc);
+
+/* --- Fonction de voisinage approchée (HyperANF) --- */
+
+#define VOISINAGE_LOG2_REGISTRES 7   /**< 128 registres : ~9 % d'erreur par compteur */
+#define VOISINAGE_CENTILE        0.9 /**< Diamètre effectif : 90 % des paires */
+
+/**
+ * @brief Estime la fonction de voisinage N(t) avec des compteurs
+ *        HyperLogLog, puis distance moyenne, diamètre effectif et
+ *        proximité de chaque nœud, sans plus courts chemins toutes paires
+ *
+ * Une passe linéaire par niveau de distance ; chaque passe est répartie
+ * entre threads par blocs de nœuds. Le résultat ne dépend pas du nombre
+ * de threads. Les compteurs partagent la même fonction de hachage : leurs
+ * erreurs ne se compensent pas et N(t) garde ~1.04 / √m d'erreur relative ;
+ * distance moyenne et diamètre effectif, rapports de N, sont plus précis.
+ *
+ * @param log2_registres Registres par compteur = 2^log2_registres, 4 à 12
+ *                       (0 = VOISINAGE_LOG2_REGISTRES) ; erreur ~1.04 / √m
+ * @param nb_threads     Nombre de threads (0 = nombre de coeurs)
+ * @return Résultat alloué (detruire_voisinage), NULL si g est NULL
+ * @complexity O(D * (V + E) * m / 8) pour un diamètre D, mémoire 2 * V * m octets
+ */
+ResultatVoisinage* estimer_voisinage(const Graphe* g, int log2_registres, int nb_threads);
+
+void detruire_voisinage(ResultatVoisinage* rv);
+
+/**
+ * @brief Affiche les indicateurs de santé du réseau (rapport de sécurité)
+ */
+void afficher_voisinage(const ResultatVoisinage* rv, const Graphe* g);
+
 /* --- Analyse globale --- */
 
 /**
  * @brief Lance une analyse complète de sécurité du graphe
+ *
+ * Un seul parcours en profondeur (pile explicite) calcule ensemble le
+ * cycle, les points d'articulation, les ponts et les SCC à partir des
+ * mêmes temps de découverte ; la durée de chaque phase est renseignée.
+ *
  * @return Structure ResultatSecurite allouée (à libérer par l'appelant)
+ * @complexity O(V + E)
  */
 ResultatSecurite* analyser_securite(const Graphe* g);
 
+/**
+ * @brief analyser_securite, plus le classement des nœuds et des liens par
+ *        centralité d'intermédiarité (latence) et les indicateurs de
+ *        voisinage (estimer_voisinage), sur demande
+ * @return Structure ResultatSecurite allouée, centralite et voisinage
+ *         renseignés
+ * @complexity celle de analyser_securite + O(V * E log V) / threads pour
+ *             la centralité + O(D * (V + E) * m / 8) pour le voisinage
+ */
+ResultatSecurite* analyser_securite_approfondie(const Graphe* g);
+
 void afficher_resultats_securite(const ResultatSecurite* res, const Graphe* g);
 void detruire_resultat_securite(ResultatSecurite* res);
 
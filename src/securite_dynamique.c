@@ -0,0 +1,922 @@
+/**
+ * @file securite_dynamique.c
+ * @brief Implémentation du suivi dynamique de la sécurité
+ *
+ * Deux structures indépendantes sur la vue non orientée du réseau :
+ *   1. Connectivité (Holm - de Lichtenberg - Thorup) : une forêt couvrante
+ *      par niveau, chaque arbre rangé comme un tour d'Euler dans un arbre
+ *      splay. Une arête d'arbre supprimée est remplacée par une arête hors
+ *      arbre de même niveau ; les arêtes examinées sans succès montent d'un
+ *      niveau, ce qui borne le travail amorti à O(log² V)
+ *   2. Blocs : forêt couvrante enracinée et union-find sur ses arêtes. Deux
+ *      arêtes d'arbre sont dans la même classe si elles sont sur un même
+ *      cycle, donc dans le même bloc (composante biconnexe) :
+ *        - pont            = arête d'arbre seule dans sa classe
+ *        - point d'articulation = sommet touché par au moins 2 classes
+ */
+
+#include "securite_dynamique.h"
+#include "utils.h"
+#include <stdint.h>
+
+/* ============================================================
+ *  STRUCTURES INTERNES
+ * ============================================================ */
+
+#define MARQUE_ARBRE     1  /* Le sommet a des arêtes d'arbre de ce niveau */
+#define MARQUE_NON_ARBRE 2  /* Le sommet a des arêtes hors arbre de ce niveau */
+
+/**
+ * @brief Élément d'un tour d'Euler : un sommet (sommet >= 0) ou l'un des
+ *        deux arcs d'une arête d'arbre (sommet = -1)
+ */
+typedef struct NoeudETT {
+    struct NoeudETT* gauche;
+    struct NoeudETT* droite;
+    struct NoeudETT* parent;
+    int sommet;
+    int taille;              /**< Sommets dans le sous-arbre splay */
+    unsigned char marque;    /**< MARQUE_* du sommet (0 pour un arc) */
+    unsigned char agregat;   /**< OU des marques du sous-arbre */
+} NoeudETT;
+
+typedef struct ListeAretes {
+    int* ids;
+    int  nb;
+    int  capa;
+} ListeAretes;
+
+typedef struct AreteDyn {
+    int u, v;            /**< u < v */
+    int multiplicite;    /**< Arcs du graphe entre u et v */
+    int niveau;          /**< Niveau dans la hiérarchie de connectivité */
+    int dans_arbre;      /**< Arête de la forêt couvrante de connectivité */
+    int pos[2];          /**< Rang dans la liste de niveau de u (0) et de v (1) */
+    int pos_inc[2];      /**< Rang dans les listes d'incidence de u et de v */
+    NoeudETT* arcs;      /**< 2 arcs par niveau 0..niveau si dans_arbre */
+} AreteDyn;
+
+struct SecuriteDynamique {
+    int V;
+    int nb_niveaux;
+
+    /* Arêtes : emplacements réutilisés + table (u, v) -> id */
+    AreteDyn* aretes;
+    int  nb_aretes;
+    int  capa_aretes;
+    int* libres;            /**< Emplacements rendus par les suppressions */
+    int  nb_libres;
+    int* table;             /**< Adressage ouvert, -1 = case vide */
+    int  capa_table;
+    int  nb_table;
+    ListeAretes* incidentes; /**< V listes : toutes les arêtes de chaque sommet */
+
+    /* Connectivité */
+    NoeudETT*    sommets;   /**< nb_niveaux x V */
+    ListeAretes* arbre;     /**< nb_niveaux x V : arêtes d'arbre du niveau */
+    ListeAretes* non_arbre; /**< nb_niveaux x V : arêtes hors arbre du niveau */
+    int nb_composantes;
+
+    /* Blocs : forêt enracinée (par sommet) et classes (par arête d'arbre) */
+    int* parent_b;
+    int* arete_parent;      /**< Arête vers le parent, -1 à la racine */
+    int* profondeur;
+    int* nb_blocs;          /**< Classes distinctes touchant le sommet */
+    int* classe;            /**< Union-find des arêtes d'arbre */
+    int* taille_classe;
+    int* haut_classe;       /**< Sommet le plus haut de la classe */
+
+    /* Composantes de la forêt des blocs (union-find + liste circulaire) */
+    int*  comp;
+    int*  comp_taille;
+    int*  comp_suivant;
+    int*  comp_ponts;
+    int*  comp_articulations;
+    char* obsolete;         /**< Composante à recalculer (arête supprimée) */
+    char* en_attente;
+    int*  a_reconstruire;
+    int   nb_a_reconstruire;
+    int   nb_ponts;
+    int   nb_articulations;
+
+    /* Tampons de travail (V cases) */
+    int*  file;
+    int*  tampon;
+    int*  tampon2;
+    char* vu;
+};
+
+/* ============================================================
+ *  LISTES D'ARÊTES
+ *  Chaque arête connaît son rang dans les listes de ses deux extrémités :
+ *  retrait en O(1) en déplaçant la dernière arête à sa place.
+ * ============================================================ */
+
+static void liste_ajouter(ListeAretes* l, int id, int* pos) {
+    if (l->nb == l->capa) {
+        l->capa = l->capa ? 2 * l->capa : 4;
+        l->ids = (int*)realloc(l->ids, l->capa * sizeof(int));
+    }
+    *pos = l->nb;
+    l->ids[l->nb++] = id;
+}
+
+static void liste_retirer(SecuriteDynamique* sd, ListeAretes* l, int x, int id, int incidence) {
+    AreteDyn* a = &sd->aretes[id];
+    int p = (incidence ? a->pos_inc : a->pos)[a->u == x ? 0 : 1];
+    int dernier = l->ids[--l->nb];
+    AreteDyn* d = &sd->aretes[dernier];
+    l->ids[p] = dernier;
+    (incidence ? d->pos_inc : d->pos)[d->u == x ? 0 : 1] = p;
+}
+
+static ListeAretes* liste_niveau(const SecuriteDynamique* sd, ListeAretes* t, int i, int x) {
+    return &t[(size_t)i * sd->V + x];
+}
+
+/* ============================================================
+ *  TABLE (u, v) -> id
+ * ============================================================ */
+
+static unsigned hacher(int u, int v, int masque) {
+    uint64_t k = ((uint64_t)(unsigned)u << 32) | (unsigned)v;
+    k *= 0x9E3779B97F4A7C15ull;
+    return (unsigned)(k >> 32) & (unsigned)masque;
+}
+
+static int chercher_arete(const SecuriteDynamique* sd, int u, int v) {
+    int m = sd->capa_table - 1;
+    for (unsigned h = hacher(u, v, m); sd->table[h] >= 0; h = (h + 1) & m) {
+        const AreteDyn* a = &sd->aretes[sd->table[h]];
+        if (a->u == u && a->v == v) return sd->table[h];
+    }
+    return -1;
+}
+
+static void placer_dans_table(SecuriteDynamique* sd, int id) {
+    int m = sd->capa_table - 1;
+    unsigned h = hacher(sd->aretes[id].u, sd->aretes[id].v, m);
+    while (sd->table[h] >= 0) h = (h + 1) & m;
+    sd->table[h] = id;
+}
+
+static void inserer_table(SecuriteDynamique* sd, int id) {
+    if (2 * (sd->nb_table + 1) > sd->capa_table) {
+        int* ancienne = sd->table;
+        int  capa = sd->capa_table;
+        sd->capa_table *= 2;
+        sd->table = (int*)malloc(sd->capa_table * sizeof(int));
+        for (int i = 0; i < sd->capa_table; i++) sd->table[i] = -1;
+        for (int i = 0; i < capa; i++) if (ancienne[i] >= 0) placer_dans_table(sd, ancienne[i]);
+        free(ancienne);
+    }
+    placer_dans_table(sd, id);
+    sd->nb_table++;
+}
+
+/* Retrait par décalage arrière : aucune case tombe n'est nécessaire */
+static void retirer_table(SecuriteDynamique* sd, int id) {
+    int m = sd->capa_table - 1;
+    unsigned h = hacher(sd->aretes[id].u, sd->aretes[id].v, m);
+    while (sd->table[h] != id) h = (h + 1) & m;
+    sd->table[h] = -1;
+    for (unsigned j = (h + 1) & m; sd->table[j] >= 0; j = (j + 1) & m) {
+        const AreteDyn* a = &sd->aretes[sd->table[j]];
+        unsigned k = hacher(a->u, a->v, m);
+        /* L'entrée j peut combler le trou si sa case d'origine k n'est pas dans ]h, j] */
+        int dans = (h <= j) ? (k > h && k <= j) : (k > h || k <= j);
+        if (!dans) {
+            sd->table[h] = sd->table[j];
+            sd->table[j] = -1;
+            h = j;
+        }
+    }
+    sd->nb_table--;
+}
+
+static int nouvelle_arete(SecuriteDynamique* sd, int u, int v) {
+    int id;
+    if (sd->nb_libres > 0) id = sd->libres[--sd->nb_libres];
+    else {
+        if (sd->nb_aretes == sd->capa_aretes) {
+            sd->capa_aretes *= 2;
+            sd->aretes        = (AreteDyn*)realloc(sd->aretes, sd->capa_aretes * sizeof(AreteDyn));
+            sd->libres        = (int*)realloc(sd->libres, sd->capa_aretes * sizeof(int));
+            sd->classe        = (int*)realloc(sd->classe, sd->capa_aretes * sizeof(int));
+            sd->taille_classe = (int*)realloc(sd->taille_classe, sd->capa_aretes * sizeof(int));
+            sd->haut_classe   = (int*)realloc(sd->haut_classe, sd->capa_aretes * sizeof(int));
+        }
+        id = sd->nb_aretes++;
+    }
+    AreteDyn* a = &sd->aretes[id];
+    memset(a, 0, sizeof(*a));
+    a->u = u;
+    a->v = v;
+    return id;
+}
+
+/* ============================================================
+ *  TOURS D'EULER DANS DES ARBRES SPLAY
+ *  Un arbre couvrant est la séquence de son tour : chaque sommet y figure
+ *  une fois, chaque arête deux fois (un arc par sens). Relier, couper ou
+ *  réenraciner un arbre revient à découper et recoller des séquences.
+ * ============================================================ */
+
+static int taille_ett(const NoeudETT* x) { return x ? x->taille : 0; }
+
+static void maj_ett(NoeudETT* x) {
+    x->taille  = (x->sommet >= 0) + taille_ett(x->gauche) + taille_ett(x->droite);
+    x->agregat = x->marque | (x->gauche ? x->gauche->agregat : 0)
+                           | (x->droite ? x->droite->agregat : 0);
+}
+
+static void rotation(NoeudETT* x) {
+    NoeudETT* p  = x->parent;
+    NoeudETT* gp = p->parent;
+    if (p->gauche == x) {
+        p->gauche = x->droite;
+        if (x->droite) x->droite->parent = p;
+        x->droite = p;
+    } else {
+        p->droite = x->gauche;
+        if (x->gauche) x->gauche->parent = p;
+        x->gauche = p;
+    }
+    p->parent = x;
+    x->parent = gp;
+    if (gp) {
+        if (gp->gauche == p) gp->gauche = x;
+        else gp->droite = x;
+    }
+    maj_ett(p);
+    maj_ett(x);
+}
+
+static void splay(NoeudETT* x) {
+    while (x->parent) {
+        NoeudETT* p  = x->parent;
+        NoeudETT* gp = p->parent;
+        if (gp) rotation((gp->gauche == p) == (p->gauche == x) ? p : x);
+        rotation(x);
+    }
+}
+
+/* Concatène deux séquences (racines splay, NULL = vide) */
+static NoeudETT* joindre(NoeudETT* a, NoeudETT* b) {
+    if (!a) return b;
+    if (!b) return a;
+    while (a->droite) a = a->droite;
+    splay(a);
+    a->droite = b;
+    b->parent = a;
+    maj_ett(a);
+    return a;
+}
+
+/* Fait commencer le tour de x par x */
+static NoeudETT* reenraciner_ett(NoeudETT* x) {
+    splay(x);
+    NoeudETT* g = x->gauche;
+    if (!g) return x;
+    g->parent = NULL;
+    x->gauche = NULL;
+    maj_ett(x);
+    return joindre(x, g);
+}
+
+static int meme_arbre(NoeudETT* x, NoeudETT* y) {
+    if (x == y) return 1;
+    splay(x);
+    splay(y);
+    return x->parent != NULL; /* x n'est plus racine : même arbre splay */
+}
+
+static int taille_arbre(NoeudETT* x) {
+    splay(x);
+    return x->taille;
+}
+
+/* Un sommet portant la marque m dans l'arbre de x, NULL si aucun */
+static NoeudETT* chercher_marque(NoeudETT* x, unsigned char m) {
+    splay(x);
+    if (!(x->agregat & m)) return NULL;
+    for (;;) {
+        if (x->gauche && (x->gauche->agregat & m)) x = x->gauche;
+        else if (x->marque & m) break;
+        else x = x->droite;
+    }
+    splay(x);
+    return x;
+}
+
+/* Tour(u) + arc u->v + Tour(v) + arc v->u */
+static void lier_ett(NoeudETT* nu, NoeudETT* nv, NoeudETT* uv, NoeudETT* vu) {
+    memset(uv, 0, sizeof(*uv));
+    memset(vu, 0, sizeof(*vu));
+    uv->sommet = vu->sommet = -1;
+    NoeudETT* tu = reenraciner_ett(nu);
+    NoeudETT* tv = reenraciner_ett(nv);
+    joindre(joindre(joindre(tu, uv), tv), vu);
+}
+
+/* Retire les deux arcs d'une arête : la partie entre les arcs forme un arbre,
+   le reste (avant + après) l'autre */
+static void couper_ett(NoeudETT* a, NoeudETT* b) {
+    splay(a);
+    NoeudETT* avant = a->gauche;
+    if (avant) { avant->parent = NULL; a->gauche = NULL; maj_ett(a); }
+    splay(b);
+    NoeudETT* milieu;
+    NoeudETT* apres;
+    if (a->parent == NULL) {
+        /* b est dans « avant » : avant = P b Q, puis a R */
+        milieu = b->droite;
+        NoeudETT* p = b->gauche;
+        if (milieu) milieu->parent = NULL;
+        if (p) p->parent = NULL;
+        apres = a->droite;
+        if (apres) apres->parent = NULL;
+        joindre(p, apres);
+    } else {
+        /* a Q b R : b est devenu racine, a en tête de son sous-arbre gauche */
+        NoeudETT* gauche = b->gauche;
+        apres = b->droite;
+        gauche->parent = NULL;
+        if (apres) apres->parent = NULL;
+        splay(a);
+        milieu = a->droite;
+        if (milieu) milieu->parent = NULL;
+        joindre(avant, apres);
+    }
+}
+
+/* ============================================================
+ *  CONNECTIVITÉ (HOLM - DE LICHTENBERG - THORUP)
+ *  La forêt F_i contient les arêtes d'arbre de niveau >= i ; un arbre de
+ *  F_i a au plus V / 2^i sommets, d'où au plus log V niveaux.
+ * ============================================================ */
+
+static NoeudETT* noeud_sommet(const SecuriteDynamique* sd, int i, int x) {
+    return &sd->sommets[(size_t)i * sd->V + x];
+}
+
+static void actualiser_marque(SecuriteDynamique* sd, int i, int x) {
+    NoeudETT* n = noeud_sommet(sd, i, x);
+    unsigned char m = (liste_niveau(sd, sd->arbre, i, x)->nb ? MARQUE_ARBRE : 0)
+                    | (liste_niveau(sd, sd->non_arbre, i, x)->nb ? MARQUE_NON_ARBRE : 0);
+    if (m == n->marque) return;
+    splay(n);
+    n->marque = m;
+    maj_ett(n);
+}
+
+/* Range l'arête dans les listes t de son niveau, aux deux extrémités */
+static void ranger_arete(SecuriteDynamique* sd, ListeAretes* t, int id) {
+    AreteDyn* a = &sd->aretes[id];
+    for (int c = 0; c < 2; c++) {
+        int x = c ? a->v : a->u;
+        liste_ajouter(liste_niveau(sd, t, a->niveau, x), id, &a->pos[c]);
+        actualiser_marque(sd, a->niveau, x);
+    }
+}
+
+static void sortir_arete(SecuriteDynamique* sd, ListeAretes* t, int id) {
+    AreteDyn* a = &sd->aretes[id];
+    for (int c = 0; c < 2; c++) {
+        int x = c ? a->v : a->u;
+        liste_retirer(sd, liste_niveau(sd, t, a->niveau, x), x, id, 0);
+        actualiser_marque(sd, a->niveau, x);
+    }
+}
+
+static void lier_niveau(SecuriteDynamique* sd, int id, int i) {
+    AreteDyn* a = &sd->aretes[id];
+    lier_ett(noeud_sommet(sd, i, a->u), noeud_sommet(sd, i, a->v),
+             &a->arcs[2 * i], &a->arcs[2 * i + 1]);
+}
+
+static void devenir_arbre(SecuriteDynamique* sd, int id) {
+    AreteDyn* a = &sd->aretes[id];
+    a->dans_arbre = 1;
+    a->arcs = (NoeudETT*)malloc(2 * sd->nb_niveaux * sizeof(NoeudETT));
+    for (int j = 0; j <= a->niveau; j++) lier_niveau(sd, id, j);
+    ranger_arete(sd, sd->arbre, id);
+}
+
+static void inserer_connectivite(SecuriteDynamique* sd, int id) {
+    AreteDyn* a = &sd->aretes[id];
+    a->niveau = 0;
+    if (meme_arbre(noeud_sommet(sd, 0, a->u), noeud_sommet(sd, 0, a->v))) {
+        ranger_arete(sd, sd->non_arbre, id);
+        return;
+    }
+    devenir_arbre(sd, id);
+    sd->nb_composantes--;
+}
+
+/**
+ * @brief Cherche au niveau i une arête qui reconnecte les arbres de u et v
+ *
+ * Seul le plus petit des deux arbres est parcouru : ses arêtes d'arbre de
+ * niveau i montent au niveau i + 1 (il y tient, étant la moitié au plus),
+ * puis ses arêtes hors arbre de niveau i sont examinées ; celles qui
+ * restent internes montent aussi, la première qui sort devient l'arête
+ * de remplacement.
+ */
+static int chercher_remplacement(SecuriteDynamique* sd, int u, int v, int i) {
+    NoeudETT* nu = noeud_sommet(sd, i, u);
+    NoeudETT* nv = noeud_sommet(sd, i, v);
+    NoeudETT* petit = taille_arbre(nu) <= taille_arbre(nv) ? nu : nv;
+    NoeudETT* x;
+
+    while ((x = chercher_marque(petit, MARQUE_ARBRE)) != NULL) {
+        ListeAretes* l = liste_niveau(sd, sd->arbre, i, x->sommet);
+        while (l->nb > 0) {
+            int f = l->ids[l->nb - 1];
+            sortir_arete(sd, sd->arbre, f);
+            sd->aretes[f].niveau = i + 1;
+            ranger_arete(sd, sd->arbre, f);
+            lier_niveau(sd, f, i + 1);
+        }
+    }
+
+    while ((x = chercher_marque(petit, MARQUE_NON_ARBRE)) != NULL) {
+        int s = x->sommet;
+        ListeAretes* l = liste_niveau(sd, sd->non_arbre, i, s);
+        while (l->nb > 0) {
+            int f = l->ids[l->nb - 1];
+            AreteDyn* b = &sd->aretes[f];
+            int autre = (b->u == s) ? b->v : b->u;
+            sortir_arete(sd, sd->non_arbre, f);
+            if (meme_arbre(x, noeud_sommet(sd, i, autre))) {
+                b->niveau = i + 1;
+                ranger_arete(sd, sd->non_arbre, f);
+            } else {
+                devenir_arbre(sd, f);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static void supprimer_connectivite(SecuriteDynamique* sd, int id) {
+    AreteDyn* a = &sd->aretes[id];
+    if (!a->dans_arbre) {
+        sortir_arete(sd, sd->non_arbre, id);
+        return;
+    }
+    sortir_arete(sd, sd->arbre, id);
+    for (int j = 0; j <= a->niveau; j++) couper_ett(&a->arcs[2 * j], &a->arcs[2 * j + 1]);
+    free(a->arcs);
+    a->arcs = NULL;
+    a->dans_arbre = 0;
+    for (int i = a->niveau; i >= 0; i--)
+        if (chercher_remplacement(sd, a->u, a->v, i)) return;
+    sd->nb_composantes++;
+}
+
+/* ============================================================
+ *  BLOCS : PONTS ET POINTS D'ARTICULATION
+ *  Les compteurs sont tenus par composante (racine de comp) et au total ;
+ *  une composante obsolète garde ses anciens compteurs jusqu'au recalcul.
+ * ============================================================ */
+
+static int trouver_comp(SecuriteDynamique* sd, int x) {
+    while (sd->comp[x] != x) {
+        sd->comp[x] = sd->comp[sd->comp[x]];
+        x = sd->comp[x];
+    }
+    return x;
+}
+
+static int trouver_classe(SecuriteDynamique* sd, int e) {
+    while (sd->classe[e] != e) {
+        sd->classe[e] = sd->classe[sd->classe[e]];
+        e = sd->classe[e];
+    }
+    return e;
+}
+
+static void ajuster_compteurs(SecuriteDynamique* sd, int x, int d_ponts, int d_articulations) {
+    int r = trouver_comp(sd, x);
+    sd->comp_ponts[r]         += d_ponts;
+    sd->comp_articulations[r] += d_articulations;
+    sd->nb_ponts              += d_ponts;
+    sd->nb_articulations      += d_articulations;
+}
+
+static void modifier_blocs(SecuriteDynamique* sd, int x, int delta) {
+    int avant = sd->nb_blocs[x] >= 2;
+    sd->nb_blocs[x] += delta;
+    int apres = sd->nb_blocs[x] >= 2;
+    if (avant != apres) ajuster_compteurs(sd, x, 0, apres - avant);
+}
+
+static void marquer_obsolete(SecuriteDynamique* sd, int r) {
+    sd->obsolete[r] = 1;
+    if (sd->en_attente[r]) return;
+    sd->en_attente[r] = 1;
+    sd->a_reconstruire[sd->nb_a_reconstruire++] = r;
+}
+
+static int unir_composantes(SecuriteDynamique* sd, int x, int y) {
+    int rx = trouver_comp(sd, x), ry = trouver_comp(sd, y);
+    if (rx == ry) return rx;
+    if (sd->comp_taille[rx] < sd->comp_taille[ry]) { int t = rx; rx = ry; ry = t; }
+    sd->comp[ry] = rx;
+    sd->comp_taille[rx]        += sd->comp_taille[ry];
+    sd->comp_ponts[rx]         += sd->comp_ponts[ry];
+    sd->comp_articulations[rx] += sd->comp_articulations[ry];
+    int t = sd->comp_suivant[rx];
+    sd->comp_suivant[rx] = sd->comp_suivant[ry];
+    sd->comp_suivant[ry] = t;
+    if (sd->obsolete[ry]) marquer_obsolete(sd, rx);
+    return rx;
+}
+
+/* Arête d'arbre parent(y) - y : nouvelle classe, donc nouveau pont */
+static void nouvelle_arete_arbre(SecuriteDynamique* sd, int x, int y, int e) {
+    sd->parent_b[y]     = x;
+    sd->arete_parent[y] = e;
+    sd->profondeur[y]   = sd->profondeur[x] + 1;
+    sd->classe[e]        = e;
+    sd->taille_classe[e] = 1;
+    sd->haut_classe[e]   = x;
+    unir_composantes(sd, x, y);
+    ajuster_compteurs(sd, x, 1, 0);
+    modifier_blocs(sd, x, +1);
+    modifier_blocs(sd, y, +1);
+}
+
+/* Deux classes distinctes ont au plus un sommet commun : la jonction */
+static void unir_classes(SecuriteDynamique* sd, int a, int b, int jonction) {
+    a = trouver_classe(sd, a);
+    b = trouver_classe(sd, b);
+    if (a == b) return;
+    int d_ponts = -(sd->taille_classe[a] == 1) - (sd->taille_classe[b] == 1);
+    if (sd->taille_classe[a] < sd->taille_classe[b]) { int t = a; a = b; b = t; }
+    sd->classe[b] = a;
+    sd->taille_classe[a] += sd->taille_classe[b];
+    if (sd->profondeur[sd->haut_classe[b]] < sd->profondeur[sd->haut_classe[a]])
+        sd->haut_classe[a] = sd->haut_classe[b];
+    ajuster_compteurs(sd, jonction, d_ponts, 0);
+    modifier_blocs(sd, jonction, -1);
+}
+
+/**
+ * @brief Arête u-v hors arbre : toutes les arêtes du chemin u..v dans la
+ *        forêt rejoignent la même classe
+ *
+ * Chaque côté remonte de classe en classe (saut direct au sommet de la
+ * classe courante) jusqu'à la rencontre des deux côtés ; chaque étape
+ * fusionne deux classes, d'où O(log V) amorti par ajout.
+ */
+static void fusionner_cycle(SecuriteDynamique* sd, int u, int v) {
+    int x = u, y = v, cx = -1, cy = -1;
+    while (x != y) {
+        if (sd->profondeur[x] < sd->profondeur[y]) {
+            int t = x; x = y; y = t;
+            t = cx; cx = cy; cy = t;
+        }
+        int c = sd->arete_parent[x];
+        if (cx >= 0) unir_classes(sd, cx, c, x);
+        cx = trouver_classe(sd, c);
+        x  = sd->haut_classe[cx];
+    }
+    if (cx >= 0 && cy >= 0) unir_classes(sd, cx, cy, x);
+}
+
+/**
+ * @brief Arête u-v entre deux composantes : la plus petite est réenracinée
+ *        en son extrémité puis accrochée sous l'autre
+ * @complexity O(taille de la plus petite composante), O(log V) amorti
+ */
+static void lier_blocs(SecuriteDynamique* sd, int u, int v, int id) {
+    if (sd->comp_taille[trouver_comp(sd, u)] < sd->comp_taille[trouver_comp(sd, v)]) {
+        int t = u; u = v; v = t;
+    }
+    int* file = sd->file;
+    int* nouv_parent = sd->tampon;
+    int* nouv_arete  = sd->tampon2;
+    int nb = 0;
+
+    /* Parcours en largeur depuis v sur les arêtes de la forêt actuelle */
+    file[nb++] = v;
+    sd->vu[v] = 1;
+    for (int t = 0; t < nb; t++) {
+        int x = file[t];
+        ListeAretes* l = &sd->incidentes[x];
+        for (int j = 0; j < l->nb; j++) {
+            int e = l->ids[j];
+            int y = (sd->aretes[e].u == x) ? sd->aretes[e].v : sd->aretes[e].u;
+            if (sd->vu[y]) continue;
+            if (sd->arete_parent[x] != e && sd->arete_parent[y] != e) continue;
+            sd->vu[y] = 1;
+            nouv_parent[y] = x;
+            nouv_arete[y]  = e;
+            file[nb++] = y;
+        }
+    }
+
+    /* Orientation depuis v, puis sommets des classes : la première arête
+       d'une classe dans l'ordre du parcours est la plus haute */
+    for (int t = 0; t < nb; t++) {
+        int x = file[t];
+        sd->vu[x] = 0;
+        if (t == 0) continue;
+        sd->parent_b[x]     = nouv_parent[x];
+        sd->arete_parent[x] = nouv_arete[x];
+        sd->haut_classe[trouver_classe(sd, nouv_arete[x])] = -1;
+    }
+    sd->parent_b[v] = u;
+    sd->profondeur[v] = sd->profondeur[u] + 1;
+    for (int t = 1; t < nb; t++) {
+        int x = file[t];
+        sd->profondeur[x] = sd->profondeur[sd->parent_b[x]] + 1;
+        int c = trouver_classe(sd, sd->arete_parent[x]);
+        if (sd->haut_classe[c] < 0) sd->haut_classe[c] = sd->parent_b[x];
+    }
+    nouvelle_arete_arbre(sd, u, v, id);
+}
+
+/**
+ * @brief Recalcule les blocs d'une composante qui a perdu des arêtes :
+ *        nouvelle forêt par parcours en largeur, puis fusion des cycles
+ *        des arêtes hors arbre (la composante peut se scinder)
+ * @complexity O((V_c + E_c) α(V))
+ */
+static void reconstruire_blocs(SecuriteDynamique* sd, int r) {
+    int* membres = sd->tampon;
+    int nb = 0;
+    int x = r;
+    do { membres[nb++] = x; x = sd->comp_suivant[x]; } while (x != r);
+
+    sd->nb_ponts         -= sd->comp_ponts[r];
+    sd->nb_articulations -= sd->comp_articulations[r];
+    for (int k = 0; k < nb; k++) {
+        x = membres[k];
+        sd->comp[x] = sd->comp_suivant[x] = x;
+        sd->comp_taille[x] = 1;
+        sd->comp_ponts[x] = sd->comp_articulations[x] = 0;
+        sd->obsolete[x] = 0;
+        sd->parent_b[x] = sd->arete_parent[x] = -1;
+        sd->profondeur[x] = 0;
+        sd->nb_blocs[x] = 0;
+    }
+
+    int* file = sd->file;
+    for (int k = 0; k < nb; k++) {
+        if (sd->vu[membres[k]]) continue;
+        int nf = 0;
+        file[nf++] = membres[k];
+        sd->vu[membres[k]] = 1;
+        for (int t = 0; t < nf; t++) {
+            x = file[t];
+            ListeAretes* l = &sd->incidentes[x];
+            for (int j = 0; j < l->nb; j++) {
+                int e = l->ids[j];
+                int y = (sd->aretes[e].u == x) ? sd->aretes[e].v : sd->aretes[e].u;
+                if (sd->vu[y]) continue;
+                sd->vu[y] = 1;
+                nouvelle_arete_arbre(sd, x, y, e);
+                file[nf++] = y;
+            }
+        }
+    }
+
+    for (int k = 0; k < nb; k++) {
+        x = membres[k];
+        sd->vu[x] = 0;
+        ListeAretes* l = &sd->incidentes[x];
+        for (int j = 0; j < l->nb; j++) {
+            int e = l->ids[j];
+            const AreteDyn* a = &sd->aretes[e];
+            if (a->u != x || sd->arete_parent[a->u] == e || sd->arete_parent[a->v] == e)
+                continue;
+            fusionner_cycle(sd, a->u, a->v);
+        }
+    }
+}
+
+static void actualiser_blocs(SecuriteDynamique* sd) {
+    while (sd->nb_a_reconstruire > 0) {
+        int r = sd->a_reconstruire[--sd->nb_a_reconstruire];
+        sd->en_attente[r] = 0;
+        if (sd->comp[r] == r && sd->obsolete[r]) reconstruire_blocs(sd, r);
+    }
+}
+
+static void actualiser_composante(SecuriteDynamique* sd, int x) {
+    int r = trouver_comp(sd, x);
+    if (sd->obsolete[r]) reconstruire_blocs(sd, r);
+}
+
+static void inserer_blocs(SecuriteDynamique* sd, int id) {
+    int u = sd->aretes[id].u, v = sd->aretes[id].v;
+    int ru = trouver_comp(sd, u), rv = trouver_comp(sd, v);
+    if (sd->obsolete[ru] || sd->obsolete[rv]) {
+        marquer_obsolete(sd, unir_composantes(sd, ru, rv));
+        return;
+    }
+    if (ru != rv) lier_blocs(sd, u, v, id);
+    else fusionner_cycle(sd, u, v);
+}
+
+/* ============================================================
+ *  ARCS DU GRAPHE -> ARÊTES NON ORIENTÉES
+ * ============================================================ */
+
+static void enregistrer_arc(SecuriteDynamique* sd, int u, int v) {
+    if (u > v) { int t = u; u = v; v = t; }
+    int id = chercher_arete(sd, u, v);
+    if (id >= 0) { sd->aretes[id].multiplicite++; return; }
+
+    id = nouvelle_arete(sd, u, v);
+    AreteDyn* a = &sd->aretes[id];
+    a->multiplicite = 1;
+    inserer_table(sd, id);
+    liste_ajouter(&sd->incidentes[u], id, &a->pos_inc[0]);
+    liste_ajouter(&sd->incidentes[v], id, &a->pos_inc[1]);
+    inserer_connectivite(sd, id);
+    inserer_blocs(sd, id);
+}
+
+static void retirer_arc(SecuriteDynamique* sd, int u, int v) {
+    if (u > v) { int t = u; u = v; v = t; }
+    int id = chercher_arete(sd, u, v);
+    if (id < 0 || --sd->aretes[id].multiplicite > 0) return;
+
+    supprimer_connectivite(sd, id);
+    marquer_obsolete(sd, trouver_comp(sd, u));
+    liste_retirer(sd, &sd->incidentes[u], u, id, 1);
+    liste_retirer(sd, &sd->incidentes[v], v, id, 1);
+    retirer_table(sd, id);
+    sd->libres[sd->nb_libres++] = id;
+}
+
+/* ============================================================
+ *  CRÉATION / DESTRUCTION
+ * ============================================================ */
+
+SecuriteDynamique* creer_securite_dynamique(const Graphe* g) {
+    if (!g) return NULL;
+    SecuriteDynamique* sd = (SecuriteDynamique*)calloc(1, sizeof(SecuriteDynamique));
+    int V = g->capacite_max;
+    sd->V = V;
+    sd->nb_niveaux = 2;
+    while ((1 << (sd->nb_niveaux - 1)) < V) sd->nb_niveaux++;
+
+    sd->capa_aretes   = 64;
+    sd->aretes        = (AreteDyn*)malloc(sd->capa_aretes * sizeof(AreteDyn));
+    sd->libres        = (int*)malloc(sd->capa_aretes * sizeof(int));
+    sd->classe        = (int*)malloc(sd->capa_aretes * sizeof(int));
+    sd->taille_classe = (int*)malloc(sd->capa_aretes * sizeof(int));
+    sd->haut_classe   = (int*)malloc(sd->capa_aretes * sizeof(int));
+    sd->capa_table    = 128;
+    sd->table         = (int*)malloc(sd->capa_table * sizeof(int));
+    for (int i = 0; i < sd->capa_table; i++) sd->table[i] = -1;
+    sd->incidentes    = (ListeAretes*)calloc(V, sizeof(ListeAretes));
+
+    size_t nb_listes = (size_t)sd->nb_niveaux * V;
+    sd->sommets   = (NoeudETT*)calloc(nb_listes, sizeof(NoeudETT));
+    sd->arbre     = (ListeAretes*)calloc(nb_listes, sizeof(ListeAretes));
+    sd->non_arbre = (ListeAretes*)calloc(nb_listes, sizeof(ListeAretes));
+    for (size_t i = 0; i < nb_listes; i++) {
+        sd->sommets[i].sommet = (int)(i % V);
+        sd->sommets[i].taille = 1;
+    }
+    sd->nb_composantes = g->nb_noeuds;
+
+    sd->parent_b           = (int*)malloc(V * sizeof(int));
+    sd->arete_parent       = (int*)malloc(V * sizeof(int));
+    sd->profondeur         = (int*)calloc(V, sizeof(int));
+    sd->nb_blocs           = (int*)calloc(V, sizeof(int));
+    sd->comp               = (int*)malloc(V * sizeof(int));
+    sd->comp_taille        = (int*)malloc(V * sizeof(int));
+    sd->comp_suivant       = (int*)malloc(V * sizeof(int));
+    sd->comp_ponts         = (int*)calloc(V, sizeof(int));
+    sd->comp_articulations = (int*)calloc(V, sizeof(int));
+    sd->obsolete           = (char*)calloc(V, sizeof(char));
+    sd->en_attente         = (char*)calloc(V, sizeof(char));
+    sd->a_reconstruire     = (int*)malloc(V * sizeof(int));
+    sd->file               = (int*)malloc(V * sizeof(int));
+    sd->tampon             = (int*)malloc(V * sizeof(int));
+    sd->tampon2            = (int*)malloc(V * sizeof(int));
+    sd->vu                 = (char*)calloc(V, sizeof(char));
+    for (int i = 0; i < V; i++) {
+        sd->parent_b[i] = sd->arete_parent[i] = -1;
+        sd->comp[i] = sd->comp_suivant[i] = i;
+        sd->comp_taille[i] = 1;
+    }
+
+    for (int u = 0; u < V; u++) {
+        if (!g->noeuds[u].actif) continue;
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant)
+            if (a->destination != u) enregistrer_arc(sd, u, a->destination);
+    }
+    return sd;
+}
+
+void detruire_securite_dynamique(SecuriteDynamique* sd) {
+    if (!sd) return;
+    size_t nb_listes = (size_t)sd->nb_niveaux * sd->V;
+    for (size_t i = 0; i < nb_listes; i++) {
+        free(sd->arbre[i].ids);
+        free(sd->non_arbre[i].ids);
+    }
+    for (int i = 0; i < sd->V; i++) free(sd->incidentes[i].ids);
+    for (int i = 0; i < sd->nb_aretes; i++) free(sd->aretes[i].arcs);
+    free(sd->aretes); free(sd->libres); free(sd->table); free(sd->incidentes);
+    free(sd->sommets); free(sd->arbre); free(sd->non_arbre);
+    free(sd->parent_b); free(sd->arete_parent); free(sd->profondeur); free(sd->nb_blocs);
+    free(sd->classe); free(sd->taille_classe); free(sd->haut_classe);
+    free(sd->comp); free(sd->comp_taille); free(sd->comp_suivant);
+    free(sd->comp_ponts); free(sd->comp_articulations);
+    free(sd->obsolete); free(sd->en_attente); free(sd->a_reconstruire);
+    free(sd->file); free(sd->tampon); free(sd->tampon2); free(sd->vu);
+    free(sd);
+}
+
+/* ============================================================
+ *  MISES À JOUR
+ * ============================================================ */
+
+int securite_dyn_ajouter_arete(SecuriteDynamique* sd, Graphe* g, int src, int dest,
+                               float latence, float bande_passante,
+                               float cout, int securite) {
+    if (!sd || ajouter_arete(g, src, dest, latence, bande_passante, cout, securite) != 0)
+        return -1;
+    if (src != dest) {
+        enregistrer_arc(sd, src, dest);
+        if (!g->est_oriente) enregistrer_arc(sd, dest, src);
+    }
+    return 0;
+}
+
+int securite_dyn_supprimer_arete(SecuriteDynamique* sd, Graphe* g, int src, int dest) {
+    if (!sd || supprimer_arete(g, src, dest) != 0) return -1;
+    if (src != dest) retirer_arc(sd, src, dest);
+    return 0;
+}
+
+/* ============================================================
+ *  REQUÊTES
+ * ============================================================ */
+
+int securite_dyn_connectes(SecuriteDynamique* sd, int u, int v) {
+    if (!sd || u < 0 || v < 0 || u >= sd->V || v >= sd->V) return 0;
+    return meme_arbre(noeud_sommet(sd, 0, u), noeud_sommet(sd, 0, v));
+}
+
+int securite_dyn_nb_composantes(const SecuriteDynamique* sd) {
+    return sd ? sd->nb_composantes : 0;
+}
+
+int securite_dyn_est_pont(SecuriteDynamique* sd, int u, int v) {
+    if (!sd || u == v || u < 0 || v < 0 || u >= sd->V || v >= sd->V) return 0;
+    if (u > v) { int t = u; u = v; v = t; }
+    int id = chercher_arete(sd, u, v);
+    if (id < 0) return 0;
+    actualiser_composante(sd, u);
+    if (sd->arete_parent[u] != id && sd->arete_parent[v] != id) return 0;
+    return sd->taille_classe[trouver_classe(sd, id)] == 1;
+}
+
+int securite_dyn_est_articulation(SecuriteDynamique* sd, int x) {
+    if (!sd || x < 0 || x >= sd->V) return 0;
+    actualiser_composante(sd, x);
+    return sd->nb_blocs[x] >= 2;
+}
+
+int securite_dyn_nb_ponts(SecuriteDynamique* sd) {
+    if (!sd) return 0;
+    actualiser_blocs(sd);
+    return sd->nb_ponts;
+}
+
+int securite_dyn_nb_articulations(SecuriteDynamique* sd) {
+    if (!sd) return 0;
+    actualiser_blocs(sd);
+    return sd->nb_articulations;
+}
+
+void securite_dyn_resultat(SecuriteDynamique* sd, ResultatSecurite* res) {
+    if (!sd || !res) return;
+    actualiser_blocs(sd);
+
+    res->nb_points_articulation = sd->nb_articulations;
+    res->points_articulation = (int*)malloc((sd->nb_articulations + 1) * sizeof(int));
+    res->nb_ponts = sd->nb_ponts;
+    res->ponts = (int*)malloc((2 * sd->nb_ponts + 1) * sizeof(int));
+    int na = 0, np = 0;
+    for (int x = 0; x < sd->V; x++) {
+        if (sd->nb_blocs[x] >= 2) res->points_articulation[na++] = x;
+        int e = sd->arete_parent[x];
+        if (e >= 0 && sd->taille_classe[trouver_classe(sd, e)] == 1) {
+            res->ponts[2 * np]     = sd->parent_b[x];
+            res->ponts[2 * np + 1] = x;
+            np++;
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * @file securite_dynamique.h
+ * @brief Suivi dynamique de la connectivité, des ponts et des points
+ *        d'articulation au fil des modifications d'arêtes
+ * @details Évite de relancer analyser_securite après chaque ajout ou
+ *          suppression d'arête. La structure suit la vue non orientée du
+ *          réseau (u et v sont reliés dès qu'un arc existe entre eux, dans
+ *          un sens ou dans l'autre), celle où ponts et points
+ *          d'articulation ont un sens ; sur un graphe non orienté elle
+ *          donne les mêmes résultats que trouver_points_articulation.
+ *
+ * Complexité :
+ *   - connectivité (Holm - de Lichtenberg - Thorup) : O(log² V) amorti par
+ *     mise à jour, O(log V) par requête
+ *   - ponts / points d'articulation : ajout en O(log V) amorti ; une
+ *     suppression marque sa composante, recalculée en O(V_c + E_c) à la
+ *     prochaine requête qui la concerne (plusieurs suppressions
+ *     successives ne coûtent qu'un recalcul)
+ *
+ * Les nœuds ajoutés ou supprimés après la création ne sont pas suivis :
+ * recréer la structure dans ce cas.
+ *
+ * @authors Groupe NetFlow - UVCI ALC2101 2025-2026
+ */
+
+#ifndef SECURITE_DYNAMIQUE_H
+#define SECURITE_DYNAMIQUE_H
+
+#include "interfaces.h"
+#include "graphe.h"
+
+typedef struct SecuriteDynamique SecuriteDynamique;
+
+/* --- Création / Destruction --- */
+
+/**
+ * @brief Construit la structure à partir des arcs actuels du graphe
+ * @complexity O(E log² V) amorti
+ */
+SecuriteDynamique* creer_securite_dynamique(const Graphe* g);
+
+void detruire_securite_dynamique(SecuriteDynamique* sd);
+
+/* --- Mises à jour (le graphe est modifié en même temps) --- */
+
+/**
+ * @brief ajouter_arete sur g, puis mise à jour de la structure
+ * @return 0 = succès, -1 = erreur (rien n'est modifié)
+ * @complexity O(log² V) amorti
+ */
+int securite_dyn_ajouter_arete(SecuriteDynamique* sd, Graphe* g, int src, int dest,
+                               float latence, float bande_passante,
+                               float cout, int securite);
+
+/**
+ * @brief supprimer_arete sur g (arc src -> dest), puis mise à jour : le
+ *        lien u-v ne disparaît qu'avec son dernier arc
+ * @return 0 = succès, -1 = arc absent
+ * @complexity O(log² V) amorti
+ */
+int securite_dyn_supprimer_arete(SecuriteDynamique* sd, Graphe* g, int src, int dest);
+
+/* --- Requêtes --- */
+
+/**
+ * @brief 1 si u et v sont dans la même composante connexe
+ * @complexity O(log V) amorti
+ */
+int securite_dyn_connectes(SecuriteDynamique* sd, int u, int v);
+
+/**
+ * @brief Nombre de composantes connexes (nœuds actifs à la création) ;
+ *        le réseau est connexe si elle vaut 1
+ * @complexity O(1)
+ */
+int securite_dyn_nb_composantes(const SecuriteDynamique* sd);
+
+/**
+ * @brief 1 si le lien u-v existe et est un pont
+ * @complexity O(α(E)), plus le recalcul de la composante si elle a perdu
+ *             une arête depuis la dernière requête
+ */
+int securite_dyn_est_pont(SecuriteDynamique* sd, int u, int v);
+
+/**
+ * @brief 1 si x est un point d'articulation
+ * @complexity O(1), plus le recalcul éventuel de sa composante
+ */
+int securite_dyn_est_articulation(SecuriteDynamique* sd, int x);
+
+int securite_dyn_nb_ponts(SecuriteDynamique* sd);
+int securite_dyn_nb_articulations(SecuriteDynamique* sd);
+
+/**
+ * @brief Remplit points_articulation (ordre croissant) et ponts (paires à
+ *        plat, parent -> enfant dans la forêt couvrante) comme
+ *        trouver_points_articulation ; tableaux à libérer par l'appelant
+ * @complexity O(V), plus les recalculs en attente
+ */
+void securite_dyn_resultat(SecuriteDynamique* sd, ResultatSecurite* res);
+
+#endif /* SECURITE_DYNAMIQUE_H */
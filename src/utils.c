@@ -4,12 +4,14 @@
  */
 
 #include "utils.h"
+#include <pthread.h>
 #include <time.h>
 
 #ifdef _WIN32
 #include <windows.h>
 #else
 #include <sys/time.h>
+#include <unistd.h>
 #endif
 
 /* ============================================================
@@ -118,6 +120,82 @@ int file_simple_vide(const FileSimple* f) {
     return (!f || f->taille == 0);
 }
 
+/* ============================================================
+ *  TAS BINAIRE MIN
+ * ============================================================ */
+
+TasMin* creer_tas(int capacite_initiale) {
+    TasMin* t = (TasMin*)malloc(sizeof(TasMin));
+    if (!t) return NULL;
+    if (capacite_initiale < 16) capacite_initiale = 16;
+    t->elements = (ElementTas*)malloc(capacite_initiale * sizeof(ElementTas));
+    if (!t->elements) { free(t); return NULL; }
+    t->taille   = 0;
+    t->capacite = capacite_initiale;
+    return t;
+}
+
+void detruire_tas(TasMin* t) {
+    if (!t) return;
+    free(t->elements);
+    free(t);
+}
+
+void tas_inserer(TasMin* t, int valeur, float cle) {
+    if (!t) return;
+    if (t->taille == t->capacite) {
+        ElementTas* e = (ElementTas*)realloc(t->elements,
+                            2 * t->capacite * sizeof(ElementTas));
+        if (!e) { fprintf(stderr, "Erreur realloc tas\n"); return; }
+        t->elements = e;
+        t->capacite *= 2;
+    }
+    /* Remontee */
+    int i = t->taille++;
+    while (i > 0) {
+        int p = (i - 1) / 2;
+        if (t->elements[p].cle <= cle) break;
+        t->elements[i] = t->elements[p];
+        i = p;
+    }
+    t->elements[i].cle    = cle;
+    t->elements[i].valeur = valeur;
+}
+
+int tas_extraire_min(TasMin* t, float* cle) {
+    if (!t || t->taille == 0) return -1;
+    ElementTas min = t->elements[0];
+    ElementTas dernier = t->elements[--t->taille];
+    /* Descente */
+    int i = 0;
+    while (2 * i + 1 < t->taille) {
+        int f = 2 * i + 1;
+        if (f + 1 < t->taille && t->elements[f + 1].cle < t->elements[f].cle) f++;
+        if (dernier.cle <= t->elements[f].cle) break;
+        t->elements[i] = t->elements[f];
+        i = f;
+    }
+    if (t->taille > 0) t->elements[i] = dernier;
+    if (cle) *cle = min.cle;
+    return min.valeur;
+}
+
+int tas_vide(const TasMin* t) {
+    return (!t || t->taille == 0);
+}
+
+void tas_vider(TasMin* t) {
+    if (t) t->taille = 0;
+}
+
+/* ============================================================
+ *  ENSEMBLES DE BITS
+ * ============================================================ */
+
+uint64_t* creer_bitset(int n) {
+    return (uint64_t*)calloc(BITSET_MOTS(n > 0 ? n : 1), sizeof(uint64_t));
+}
+
 /* ============================================================
  *  UTILITAIRES D'AFFICHAGE ET MESURE
  * ============================================================ */
@@ -139,6 +217,33 @@ double temps_ms(void) {
 #endif
 }
 
+int nb_threads_disponibles(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+void executer_en_parallele(void* (*fn)(void*), void* taches, size_t taille, int nb) {
+    char* base = (char*)taches;
+    pthread_t* threads = nb > 1 ? (pthread_t*)malloc(nb * sizeof(pthread_t)) : NULL;
+    char* lance = nb > 1 ? (char*)calloc(nb, sizeof(char)) : NULL;
+    if (threads && lance)
+        for (int i = 1; i < nb; i++)
+            lance[i] = pthread_create(&threads[i], NULL, fn, base + i * taille) == 0;
+    fn(base);
+    for (int i = 1; i < nb; i++)
+        if (!lance || !lance[i]) fn(base + i * taille);
+    for (int i = 1; i < nb; i++)
+        if (lance && lance[i]) pthread_join(threads[i], NULL);
+    free(threads);
+    free(lance);
+}
+
 int rand_entre(int min, int max) {
     if (max <= min) return min;
     return min + rand() % (max - min + 1);
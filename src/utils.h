@@ -11,6 +11,7 @@
 #define UTILS_H
 
 #include "interfaces.h"
+#include <stdint.h>
 
 /* ============================================================
  *  PILE (LIFO) - utilisee par DFS, backtracking, Tarjan
@@ -90,6 +91,63 @@ int defiler_simple(FileSimple* f);
  */
 int file_simple_vide(const FileSimple* f);
 
+/* ============================================================
+ *  TAS BINAIRE MIN - utilise par Dijkstra et ses variantes
+ * ============================================================ */
+
+/**
+ * @brief Cree un tas vide (le tableau grandit a la demande)
+ * @complexity O(1)
+ */
+TasMin* creer_tas(int capacite_initiale);
+
+/**
+ * @brief Libere le tas
+ * @complexity O(1)
+ */
+void detruire_tas(TasMin* t);
+
+/**
+ * @brief Insere une valeur avec sa cle
+ * @complexity O(log n) amorti
+ */
+void tas_inserer(TasMin* t, int valeur, float cle);
+
+/**
+ * @brief Extrait la valeur de cle minimale
+ * @param cle Cle de l'element extrait (peut etre NULL)
+ * @return Valeur extraite, -1 si tas vide
+ * @complexity O(log n)
+ */
+int tas_extraire_min(TasMin* t, float* cle);
+
+/**
+ * @brief Teste si le tas est vide
+ * @complexity O(1)
+ */
+int tas_vide(const TasMin* t);
+
+/**
+ * @brief Vide le tas sans liberer le tableau (reutilisation)
+ * @complexity O(1)
+ */
+void tas_vider(TasMin* t);
+
+/* ============================================================
+ *  ENSEMBLES DE BITS - appartenance O(1) sur les IDs de noeuds
+ * ============================================================ */
+
+#define BITSET_MOTS(n)       (((n) + 63) / 64)
+#define BITSET_TEST(b, i)    (((b)[(i) >> 6] >> ((i) & 63)) & 1u)
+#define BITSET_AJOUTER(b, i) ((b)[(i) >> 6] |=  (UINT64_C(1) << ((i) & 63)))
+#define BITSET_RETIRER(b, i) ((b)[(i) >> 6] &= ~(UINT64_C(1) << ((i) & 63)))
+
+/**
+ * @brief Alloue un ensemble vide pour les IDs 0..n-1 (liberer avec free)
+ * @complexity O(n / 64)
+ */
+uint64_t* creer_bitset(int n);
+
 /* ============================================================
  *  UTILITAIRES D'AFFICHAGE ET MESURE
  * ============================================================ */
@@ -104,6 +162,21 @@ void afficher_separateur(const char* titre);
  */
 double temps_ms(void);
 
+/**
+ * @brief Nombre de coeurs logiques disponibles (au moins 1)
+ */
+int nb_threads_disponibles(void);
+
+/**
+ * @brief Execute fn sur nb taches : la tache 0 dans le thread appelant,
+ *        les autres dans des threads. Une tache dont le thread n'a pas pu
+ *        etre cree s'execute aussi dans l'appelant ; seuls les threads
+ *        demarres sont attendus. Retour une fois toutes les taches finies
+ * @param taches Tableau de nb taches de taille octets (taille 0 : meme
+ *               argument pour toutes)
+ */
+void executer_en_parallele(void* (*fn)(void*), void* taches, size_t taille, int nb);
+
 /**
  * @brief Genere un entier aleatoire dans [min, max]
  */
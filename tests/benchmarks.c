@@ -0,0 +1,163 @@
+/**
+ * @file benchmarks.c
+ * @brief Mesures de performance comparées (make bench)
+ * @details Graphes générés aléatoirement ; chaque variante est vérifiée
+ *          contre l'algorithme de référence avant d'afficher les temps.
+ */
+
+#include <stdio.h>
+#include "../src/graphe.h"
+#include "../src/securite.h"
+#include "../src/connectivite.h"
+#include "../src/utils.h"
+
+#define REPETITIONS 3
+
+/* Graphe orienté : n nœuds, degré sortant moyen deg, quelques grands cycles */
+static Graphe* generer_graphe(int n, int deg, unsigned graine) {
+    srand(graine);
+    Graphe* g = creer_graphe(n, 1);
+    for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i < n * deg; i++) {
+        int s = rand_entre(0, n - 1), d = rand_entre(0, n - 1);
+        if (s != d) ajouter_arete(g, s, d, 1.0f, 100.0f, 1.0f, 5);
+    }
+    return g;
+}
+
+static int meme_partition(const int* a, const int* b, int n) {
+    int* vers_b = (int*)malloc(n * sizeof(int));
+    int ok = 1;
+    for (int i = 0; i < n; i++) vers_b[i] = -1;
+    for (int v = 0; v < n && ok; v++) {
+        if (a[v] < 0) { ok = (b[v] < 0); continue; }
+        if (vers_b[a[v]] < 0) vers_b[a[v]] = b[v];
+        ok = (vers_b[a[v]] == b[v]);
+    }
+    free(vers_b);
+    return ok;
+}
+
+/* ============================================================
+ *  SCC : Tarjan séquentiel contre avant-arrière parallèle
+ * ============================================================ */
+
+static double mesurer_scc(const Graphe* g, int nb_threads, ResultatSecurite* res) {
+    double meilleur = -1.0;
+    for (int r = 0; r < REPETITIONS; r++) {
+        ResultatSecurite tmp = {0};
+        double t0 = temps_ms();
+        if (nb_threads == 0) tarjan_scc(g, &tmp);
+        else scc_parallele(g, &tmp, nb_threads);
+        double t = temps_ms() - t0;
+        if (meilleur < 0.0 || t < meilleur) meilleur = t;
+        if (r == 0) *res = tmp;
+        else free(tmp.composantes);
+    }
+    return meilleur;
+}
+
+static void bench_scc(void) {
+    int coeurs = nb_threads_disponibles();
+    int tailles[][2] = {{1000, 1}, {1000, 4}, {2000, 2}, {3000, 1}, {3000, 8}};
+    printf("\n--- SCC : Tarjan vs avant-arriere parallele (%d coeur(s)) ---\n", coeurs);
+    printf("  %6s %4s %8s | %10s | %10s | %10s | %s\n",
+           "V", "deg", "SCC", "Tarjan", "FW-BW x1", "FW-BW xN", "partition");
+    for (size_t i = 0; i < sizeof(tailles) / sizeof(tailles[0]); i++) {
+        int n = tailles[i][0], deg = tailles[i][1];
+        Graphe* g = generer_graphe(n, deg, 42u + (unsigned)i);
+        ResultatSecurite ref = {0}, r1 = {0}, rn = {0};
+        double t_ref = mesurer_scc(g, 0, &ref);
+        double t_1   = mesurer_scc(g, 1, &r1);
+        double t_n   = mesurer_scc(g, coeurs, &rn);
+        int ok = ref.nb_composantes == r1.nb_composantes &&
+                 ref.nb_composantes == rn.nb_composantes &&
+                 meme_partition(ref.composantes, r1.composantes, n) &&
+                 meme_partition(ref.composantes, rn.composantes, n);
+        printf("  %6d %4d %8d | %8.2fms | %8.2fms | %8.2fms | %s\n",
+               n, deg, ref.nb_composantes, t_ref, t_1, t_n, ok ? "identique" : "DIFFERENTE");
+        free(ref.composantes); free(r1.composantes); free(rn.composantes);
+        detruire_graphe(g);
+    }
+}
+
+/* ============================================================
+ *  CENTRALITÉ : Brandes séquentiel contre sources réparties
+ * ============================================================ */
+
+static void bench_centralite(void) {
+    int coeurs = nb_threads_disponibles();
+    int tailles[][2] = {{500, 4}, {1000, 4}, {2000, 2}};
+    printf("\n--- Centralite d'intermediarite (%d coeur(s)) ---\n", coeurs);
+    printf("  %6s %4s %-8s | %10s | %10s | %s\n",
+           "V", "deg", "mode", "x1", "xN", "valeurs");
+    for (size_t i = 0; i < sizeof(tailles) / sizeof(tailles[0]); i++) {
+        int n = tailles[i][0], deg = tailles[i][1];
+        Graphe* g = generer_graphe(n, deg, 7u + (unsigned)i);
+        for (int mode = CENTRALITE_NON_PONDEREE; mode <= CENTRALITE_LATENCE; mode++) {
+            ResultatCentralite* r1 = centralite_intermediarite(g, mode, 1);
+            ResultatCentralite* rn = centralite_intermediarite(g, mode, coeurs);
+            int ok = 1;
+            for (int v = 0; v < n; v++) {
+                double ecart = r1->noeuds[v] - rn->noeuds[v];
+                if (ecart > 1e-6 * (1.0 + r1->noeuds[v]) || -ecart > 1e-6 * (1.0 + r1->noeuds[v])) ok = 0;
+            }
+            printf("  %6d %4d %-8s | %8.2fms | %8.2fms | %s\n", n, deg,
+                   mode == CENTRALITE_LATENCE ? "latence" : "sauts",
+                   r1->temps_ms, rn->temps_ms, ok ? "identiques" : "DIFFERENTES");
+            detruire_centralite(r1);
+            detruire_centralite(rn);
+        }
+        detruire_graphe(g);
+    }
+}
+
+/* ============================================================
+ *  REDONDANCE : arbre de Gomory-Hu contre un flot par paire
+ * ============================================================ */
+
+static void bench_redondance(void) {
+    int tailles[][3] = {{500, 3, 50}, {1000, 3, 100}, {2000, 2, 100}};
+    printf("\n--- Redondance k = 3 entre sites (non oriente) ---\n");
+    printf("  %6s %4s %5s | %10s | %10s | %10s | %s\n",
+           "V", "deg", "sites", "Gomory-Hu", "flots", "noeuds", "paires faibles");
+    for (size_t i = 0; i < sizeof(tailles) / sizeof(tailles[0]); i++) {
+        int n = tailles[i][0], deg = tailles[i][1], nb = tailles[i][2];
+        srand(90u + (unsigned)i);
+        Graphe* g = creer_graphe(n, 0);
+        for (int v = 0; v < n; v++) ajouter_noeud(g, v, "N");
+        for (int v = 0; v < n; v++) ajouter_arete(g, v, (v + 1) % n, 1.0f, 100.0f, 1.0f, 5);
+        for (int k = 0; k < n * (deg - 1); k++) {
+            int u = rand_entre(0, n - 1), v = rand_entre(0, n - 1);
+            if (u != v) ajouter_arete(g, u, v, 1.0f, 100.0f, 1.0f, 5);
+        }
+        int* sites = (int*)malloc(nb * sizeof(int));
+        for (int k = 0; k < nb; k++) sites[k] = k * (n / nb);
+
+        double t0 = temps_ms();
+        int f_gh = verifier_redondance(g, sites, nb, 3, 0, NULL);
+        double t1 = temps_ms();
+        /* Même question par un flot par paire (graphe vu comme orienté) */
+        g->est_oriente = 1;
+        int f_flots = verifier_redondance(g, sites, nb, 3, 0, NULL) / 2;
+        g->est_oriente = 0;
+        double t2 = temps_ms();
+        int f_noeuds = verifier_redondance(g, sites, nb, 3, 1, NULL);
+        double t3 = temps_ms();
+        printf("  %6d %4d %5d | %8.2fms | %8.2fms | %8.2fms | %d liens%s, %d noeuds\n",
+               n, deg, nb, t1 - t0, t2 - t1, t3 - t2, f_gh,
+               f_gh == f_flots ? "" : " (DIFFERENT)", f_noeuds);
+        free(sites);
+        detruire_graphe(g);
+    }
+}
+
+int main(void) {
+    printf("+--------------------------------------+\n");
+    printf("|     BENCHMARKS - NetFlow             |\n");
+    printf("+--------------------------------------+\n");
+    bench_scc();
+    bench_centralite();
+    bench_redondance();
+    return 0;
+}
@@ -4,12 +4,16 @@
  */
 
 #include <assert.h>
+#include <math.h>
 #include <stdio.h>
 #include "../src/graphe.h"
 #include "../src/dijkstra.h"
 #include "../src/securite.h"
+#include "../src/securite_dynamique.h"
+#include "../src/connectivite.h"
 #include "../src/liste_chainee.h"
 #include "../src/backtracking.h"
+#include "../src/etiquettes.h"
 #include "../src/utils.h"
 #include "../src/liste_chainee.h"
 
@@ -94,10 +98,497 @@ void test_dijkstra(void) {
     detruire_graphe(g);
 }
 
+void test_bande_passante_max(void) {
+    printf("\n--- Module 2 : Bande passante maximale ---\n");
+
+    /* 0->1->3 : goulot 50 (lat 10)
+       0->2->3 : goulot 80 (lat 40)
+       0->4->3 : goulot 80 (lat 30) -> meilleur departage latence */
+    Graphe* g = creer_graphe(6, 1);
+    for (int i = 0; i < 5; i++) ajouter_noeud(g, i, "N");
+    ajouter_arete(g, 0, 1, 5.0f, 100.0f, 1.0f, 9);
+    ajouter_arete(g, 1, 3, 5.0f, 50.0f, 1.0f, 9);
+    ajouter_arete(g, 0, 2, 20.0f, 80.0f, 2.0f, 6);
+    ajouter_arete(g, 2, 3, 20.0f, 90.0f, 2.0f, 8);
+    ajouter_arete(g, 0, 4, 15.0f, 80.0f, 3.0f, 7);
+    ajouter_arete(g, 4, 3, 15.0f, 120.0f, 4.0f, 5);
+
+    TEST("goulot max = 80", bande_passante_max(g, 0, 3) == 80.0f);
+    Chemin* c = chemin_bande_passante_max(g, 0, 3);
+    TEST("chemin large trouve", c != NULL);
+    TEST("chemin large bw_minimale = 80", c && c->bw_minimale == 80.0f);
+    TEST("departage latence = 30ms", c && c->latence_totale == 30.0f);
+    TEST("chemin large passe par 4", c && chemin_contient(c, 4));
+    TEST("chemin large cout = 7", c && c->cout_total == 7.0f);
+    TEST("chemin large securite = 5", c && c->securite_min == 5);
+    detruire_chemin(c);
+
+    ajouter_noeud(g, 5, "Isole");
+    TEST("pas de chemin large = NULL", chemin_bande_passante_max(g, 0, 5) == NULL);
+    TEST("goulot inaccessible = 0", bande_passante_max(g, 0, 5) == 0.0f);
+
+    detruire_graphe(g);
+}
+
+void test_multi_sources(void) {
+    printf("\n--- Module 2 : Multi-sources (anycast) ---\n");
+
+    /* Chaine non orientee : S0 -(1)- 1 -(2)- 2 -(4)- S3 -(1)- 4 */
+    Graphe* g = creer_graphe(5, 0);
+    ajouter_noeud(g, 0, "Serveur_A"); ajouter_noeud(g, 1, "Routeur_B");
+    ajouter_noeud(g, 2, "Routeur_C"); ajouter_noeud(g, 3, "Serveur_D");
+    ajouter_noeud(g, 4, "Routeur_E");
+    ajouter_arete(g, 0, 1, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 1, 2, 2.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 2, 3, 4.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 3, 4, 1.0f, 100.0f, 1.0f, 5);
+
+    int serveurs[5];
+    int nb = trouver_noeuds_prefixe(g, "Serveur_", serveurs);
+    TEST("2 serveurs par prefixe", nb == 2);
+
+    float dist[5]; int proche[5];
+    dijkstra_multi_sources(g, serveurs, nb, dist, proche, NULL);
+    TEST("noeud 2 rattache a S0 (3ms)", proche[2] == 0 && dist[2] == 3.0f);
+    TEST("noeud 4 rattache a S3 (1ms)", proche[4] == 3 && dist[4] == 1.0f);
+    TEST("source a distance 0", dist[3] == 0.0f && proche[3] == 3);
+
+    int ids[2]; float d[2];
+    TEST("k=2 serveurs depuis 4", k_sources_plus_proches(g, 4, serveurs, nb, 2, ids, d) == 2);
+    TEST("1er = S3, 2e = S0", ids[0] == 3 && ids[1] == 0);
+    TEST("distances 1 et 8", d[0] == 1.0f && d[1] == 8.0f);
+    TEST("k borne au nb de serveurs", k_sources_plus_proches(g, 4, serveurs, nb, 5, ids, NULL) == 2);
+
+    detruire_graphe(g);
+}
+
+void test_sauts_max(void) {
+    printf("\n--- Module 2 : Chemins a sauts bornes ---\n");
+
+    /* 0->3 direct : 50ms | 0->1->3 : 30ms | 0->1->2->3 : 12ms */
+    Graphe* g = creer_graphe(5, 1);
+    for (int i = 0; i < 5; i++) ajouter_noeud(g, i, "N");
+    ajouter_arete(g, 0, 3, 50.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 0, 1, 4.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 1, 3, 26.0f, 40.0f, 1.0f, 3);
+    ajouter_arete(g, 1, 2, 4.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 2, 3, 4.0f, 100.0f, 1.0f, 5);
+
+    Chemin* c = chemin_sauts_max(g, 0, 3, 1);
+    TEST("1 saut : direct 50ms", c && c->latence_totale == 50.0f && c->longueur == 2);
+    detruire_chemin(c);
+    c = chemin_sauts_max(g, 0, 3, 2);
+    TEST("2 sauts : 30ms, bw 40, sec 3", c && c->latence_totale == 30.0f &&
+         c->bw_minimale == 40.0f && c->securite_min == 3);
+    detruire_chemin(c);
+    c = chemin_sauts_max(g, 0, 3, 10);
+    TEST("10 sauts : optimum 12ms", c && c->latence_totale == 12.0f && c->longueur == 4);
+    detruire_chemin(c);
+    TEST("0 saut vers autre noeud = NULL", chemin_sauts_max(g, 0, 3, 0) == NULL);
+    TEST("cible inaccessible = NULL", chemin_sauts_max(g, 0, 4, 5) == NULL);
+    c = chemin_sauts_max(g, 0, 3, 100000000);
+    TEST("h_max enorme borne a V-1", c && c->latence_totale == 12.0f);
+    detruire_chemin(c);
+
+    Chemin* par_h[4];
+    TEST("une passe : 4 chemins", chemins_par_sauts(g, 0, 3, 4, par_h) == 4);
+    TEST("latences 50/30/12/12", par_h[0]->latence_totale == 50.0f &&
+         par_h[1]->latence_totale == 30.0f && par_h[2]->latence_totale == 12.0f &&
+         par_h[3]->latence_totale == 12.0f);
+    for (int h = 0; h < 4; h++) detruire_chemin(par_h[h]);
+    detruire_graphe(g);
+}
+
+/* ============================================================
+ *  TESTS ROUTAGE CONTRAINT : ETIQUETTES vs BACKTRACKING
+ * ============================================================ */
+
+/* Memorise la latence du dernier meilleur chemin et le nombre d'appels */
+static void rappel_test(const Chemin* meilleur, const StatsBacktrack* stats, void* donnees) {
+    float* etat = (float*)donnees;
+    (void)stats;
+    if (meilleur) etat[0] = meilleur->latence_totale;
+    etat[1] += 1.0f;
+}
+
+/* Graphe oriente aleatoire reproductible */
+static Graphe* graphe_aleatoire(int n, int nb_aretes, unsigned graine) {
+    srand(graine);
+    Graphe* g = creer_graphe(n, 1);
+    for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i < nb_aretes; i++) {
+        int s = rand_entre(0, n - 1), d = rand_entre(0, n - 1);
+        if (s == d) continue;
+        ajouter_arete(g, s, d, (float)rand_entre(1, 20), (float)rand_entre(10, 100),
+                      (float)rand_entre(1, 10), rand_entre(0, 10));
+    }
+    return g;
+}
+
+void test_backtracking(void) {
+    printf("\n--- Routage contraint : backtracking ---\n");
+
+    /* Grille 5x5 orientee (droite / bas) : beaucoup de chemins simples */
+    Graphe* g = creer_graphe(25, 1);
+    for (int i = 0; i < 25; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i < 5; i++)
+        for (int j = 0; j < 5; j++) {
+            int u = i * 5 + j;
+            if (j < 4) ajouter_arete(g, u, u + 1, (float)(1 + (u % 3)), 100.0f, 2.0f, 5);
+            if (i < 4) ajouter_arete(g, u, u + 5, (float)(1 + (u % 4)), 100.0f, 1.0f, 5);
+        }
+    Contraintes c = {0.0f, 13.0f, 0, NULL, 0, NULL, 0};
+    StatsBacktrack st;
+    Chemin* ch = backtracking_avec_stats(g, 0, 24, &c, NULL, &st);
+    Chemin* ref = chemin_contraint_etiquettes(g, 0, 24, &c);
+    TEST("backtracking trouve un chemin", ch != NULL);
+    TEST("backtracking optimal (= etiquettes)",
+         ch && ref && ch->latence_totale == ref->latence_totale);
+    TEST("budget respecte", ch && ch->cout_total <= 13.0f);
+    TEST("bornes inferieures actives", st.elagages_bornes > 0);
+    TEST("coupes bornes comptees dans l'elagage", st.elagages_bornes <= st.branches_elaguees);
+    TEST("recherche complete : optimalite prouvee", st.optimalite_prouvee == 1);
+    detruire_chemin(ch);
+
+    /* Recherche interruptible : rappels et budget de noeuds */
+    float derniere[2] = {0.0f, 0.0f};
+    OptionsBacktrack opt = {0.0, 0, rappel_test, 0.0, derniere, 0, 0, 0, 0};
+    ch = backtracking_avec_stats(g, 0, 24, &c, &opt, &st);
+    TEST("rappel a chaque record, dernier = resultat",
+         derniere[1] >= 1.0f && ch && derniere[0] == ch->latence_totale);
+    detruire_chemin(ch);
+    opt.progression = NULL;
+    opt.max_noeuds  = 10;
+    ch = backtracking_avec_stats(g, 0, 24, &c, &opt, &st);
+    TEST("budget de noeuds respecte", st.noeuds_explores == 10);
+    TEST("budget atteint : optimalite non prouvee", st.optimalite_prouvee == 0);
+    TEST("resultat interrompu jamais meilleur que l'optimum",
+         !ch || ch->latence_totale >= ref->latence_totale);
+    detruire_chemin(ch);
+    ch = backtracking_parallele(g, 0, 24, &c, 3, &opt, &st);
+    TEST("parallele : budget atteint signale", st.optimalite_prouvee == 0);
+    detruire_chemin(ch); detruire_chemin(ref);
+
+    int oblig[1] = {20};
+    Contraintes co = {0.0f, 100.0f, 0, oblig, 1, NULL, 0};
+    ch = chemin_contraint_backtracking(g, 0, 24, &co);
+    TEST("noeud obligatoire traverse", ch && chemin_contient(ch, 20));
+
+    StatsBacktrack sp;
+    Chemin* par = backtracking_parallele(g, 0, 24, &co, 4, NULL, &sp);
+    TEST("parallele : meme latence optimale",
+         par && ch && par->latence_totale == ch->latence_totale);
+    TEST("parallele : obligatoire traverse", par && chemin_contient(par, 20));
+    TEST("parallele : stats agregees", sp.noeuds_explores > 0 && sp.chemins_trouves > 0);
+    detruire_chemin(par);
+    c.cout_max_autorise = 1.0f;
+    TEST("parallele : budget impossible = NULL",
+         backtracking_parallele(g, 0, 24, &c, 3, NULL, NULL) == NULL);
+    detruire_chemin(ch);
+
+    /* K meilleurs en une recherche : tete = optimum, prefixe de l'enumeration complete */
+    c.cout_max_autorise = 13.0f;
+    ref = chemin_contraint_backtracking(g, 0, 24, &c);
+    Chemin* tous = k_chemins_contraints(g, 0, 24, &c, 10000, NULL, &st);
+    Chemin* k5   = k_chemins_contraints(g, 0, 24, &c, 5, NULL, &sp);
+    int nb_tous = 0, tries = 1, dans_budget = 1;
+    for (Chemin* x = tous; x; x = x->suivant) {
+        nb_tous++;
+        if (x->suivant && x->suivant->latence_totale < x->latence_totale) tries = 0;
+        if (x->cout_total > 13.0f) dans_budget = 0;
+    }
+    int nb_k5 = 0, prefixe = 1;
+    Chemin* x = tous;
+    for (Chemin* y = k5; y; y = y->suivant, x = x ? x->suivant : NULL) {
+        nb_k5++;
+        if (!x || x->latence_totale != y->latence_totale) prefixe = 0;
+    }
+    TEST("K meilleurs : tries, dans le budget, tete optimale",
+         tous && ref && tries && dans_budget && tous->latence_totale == ref->latence_totale);
+    TEST("K meilleurs : 5 premiers = prefixe de l'enumeration",
+         nb_tous > 5 && nb_k5 == 5 && prefixe);
+    TEST("K meilleurs : elagage contre le K-ieme",
+         sp.noeuds_explores < st.noeuds_explores && sp.optimalite_prouvee);
+    Chemin* k_enorme = k_chemins_contraints(g, 0, 24, &c, 2000000000, NULL, NULL);
+    int nb_enorme = 0;
+    for (Chemin* y = k_enorme; y; y = y->suivant) nb_enorme++;
+    TEST("K meilleurs : K enorme = enumeration complete", nb_enorme == nb_tous);
+    detruire_liste_chemins(k_enorme);
+    detruire_liste_chemins(tous); detruire_liste_chemins(k5); detruire_chemin(ref);
+    detruire_graphe(g);
+
+    /* Maillage 6x6 non oriente, latence et cout opposes : la dominance coupe */
+    g = creer_graphe(36, 0);
+    for (int i = 0; i < 36; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i < 6; i++)
+        for (int j = 0; j < 6; j++) {
+            int u = i * 6 + j;
+            float l1 = (float)(1 + (u * 7) % 20), l2 = (float)(1 + (u * 13 + 5) % 20);
+            if (j < 5) ajouter_arete(g, u, u + 1, l1, 100.0f, 21.0f - l1, 5);
+            if (i < 5) ajouter_arete(g, u, u + 6, l2, 100.0f, 21.0f - l2, 5);
+        }
+    Contraintes cd = {0.0f, 110.0f, 0, NULL, 0, NULL, 0};
+    StatsBacktrack sm;
+    OptionsBacktrack sans_memo = {0.0, 0, NULL, 0.0, NULL, -1, 0, 0, 0};
+    ch  = backtracking_avec_stats(g, 0, 35, &cd, NULL, &st);
+    ref = backtracking_avec_stats(g, 0, 35, &cd, &sans_memo, &sm);
+    TEST("dominance : etats coupes et memorises",
+         st.elagages_dominance > 0 && st.memo_insertions > 0 && sm.elagages_dominance == 0);
+    TEST("dominance : meme optimum, moins de noeuds",
+         ch && ref && ch->latence_totale == ref->latence_totale &&
+         st.noeuds_explores < sm.noeuds_explores && st.optimalite_prouvee);
+    detruire_chemin(ch);
+
+    /* Amorce par Dijkstra filtre + voisins tries : meme optimum, moins de noeuds */
+    OptionsBacktrack heur = {0.0, 0, NULL, 0.0, NULL, 0, 0, 1, 1};
+    ch = backtracking_avec_stats(g, 0, 35, &cd, &heur, &sm);
+    TEST("heuristiques : meme optimum, moins de noeuds",
+         ch && ref && ch->latence_totale == ref->latence_totale &&
+         sm.noeuds_explores < st.noeuds_explores && sm.optimalite_prouvee);
+    detruire_chemin(ch);
+    cd.cout_max_autorise = 1000.0f;    /* Le plus rapide est faisable : amorce optimale */
+    ch = backtracking_avec_stats(g, 0, 35, &cd, &heur, &sm);
+    TEST("amorce optimale : aucun autre chemin retenu",
+         ch && sm.chemins_trouves == 0 && ch->longueur >= 11);
+    detruire_chemin(ch); detruire_chemin(ref);
+    detruire_graphe(g);
+
+    /* 3 obligatoire, accessible seulement depuis 1 : 0->1->2 le rend inaccessible.
+       6 ne mene pas a 5 et 4 est exclu : hors du sous-graphe utile */
+    g = creer_graphe(7, 1);
+    for (int i = 0; i < 7; i++) ajouter_noeud(g, i, "N");
+    ajouter_arete(g, 0, 1, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 1, 3, 10.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 3, 5, 10.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 3, 2, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 1, 2, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 2, 5, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 0, 4, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 4, 2, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 1, 6, 1.0f, 100.0f, 1.0f, 5);
+    int ob3[2] = {3, 3};
+    int ex[3] = {4, 4, 99};
+    Contraintes cm = {0.0f, 100.0f, 0, ob3, 2, ex, 3};
+    ch = backtracking_avec_stats(g, 0, 5, &cm, NULL, &st);
+    TEST("obligatoire en doublon : chemin 0-1-3-2-5",
+         ch && ch->longueur == 5 && ch->latence_totale == 13.0f);
+    TEST("obligatoire devenu inaccessible coupe", st.elagages_obligatoires > 0);
+    TEST("sous-graphe utile : 5 noeuds, 6 arcs",
+         st.noeuds_sous_graphe == 5 && st.arcs_sous_graphe == 6);
+    detruire_chemin(ch);
+    int ob4[1] = {4};
+    cm.noeuds_oblgatoires = ob4; cm.nb_obligatoires = 1;
+    TEST("obligatoire exclu = NULL", chemin_contraint_backtracking(g, 0, 5, &cm) == NULL);
+    TEST("obligatoire exclu = NULL (parallele)",
+         backtracking_parallele(g, 0, 5, &cm, 2, NULL, NULL) == NULL);
+    detruire_graphe(g);
+
+    /* Longue chaine : toute la profondeur tient dans la pile explicite */
+    int n = 2000;
+    g = creer_graphe(n, 1);
+    for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i + 1 < n; i++) ajouter_arete(g, i, i + 1, 1.0f, 100.0f, 1.0f, 5);
+    Contraintes cl = {0.0f, (float)n, 0, NULL, 0, NULL, 0};
+    ch = chemin_contraint_backtracking(g, 0, n - 1, &cl);
+    TEST("pile explicite : chaine de 2000 noeuds",
+         ch && ch->longueur == n && ch->latence_totale == (float)(n - 1));
+    detruire_chemin(ch);
+    detruire_graphe(g);
+}
+
+void test_points_passage(void) {
+    printf("\n--- Routage par points de passage (Held-Karp) ---\n");
+
+    /* Grille 5x5 orientee : obligatoires donnes dans le desordre */
+    Graphe* g = creer_graphe(25, 1);
+    for (int i = 0; i < 25; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i < 5; i++)
+        for (int j = 0; j < 5; j++) {
+            int u = i * 5 + j;
+            if (j < 4) ajouter_arete(g, u, u + 1, (float)(1 + (u % 3)), 100.0f, 2.0f, 5);
+            if (i < 4) ajouter_arete(g, u, u + 5, (float)(1 + (u % 4)), 100.0f, 1.0f, 5);
+        }
+    int oblig[3] = {18, 6, 12};
+    Contraintes c = {0.0f, 100.0f, 0, oblig, 3, NULL, 0};
+    StatsPassage sp;
+    Chemin* ch  = chemin_points_passage(g, 0, 24, &c, 2, &sp);
+    Chemin* ref = chemin_contraint_backtracking(g, 0, 24, &c);
+    TEST("points de passage : ordre exact, route simple",
+         ch && sp.nb_points == 3 && sp.ordre_exact && sp.chemin_simple);
+    TEST("points de passage : latence = backtracking",
+         ch && ref && ch->latence_totale == ref->latence_totale);
+    TEST("points de passage : tous traverses",
+         ch && chemin_contient(ch, 6) && chemin_contient(ch, 12) && chemin_contient(ch, 18));
+    detruire_chemin(ch); detruire_chemin(ref);
+    c.cout_max_autorise = 5.0f;
+    TEST("points de passage : budget depasse = NULL",
+         chemin_points_passage(g, 0, 24, &c, 1, NULL) == NULL);
+    int ex[1] = {12};
+    c.cout_max_autorise = 100.0f;
+    c.noeuds_exclus = ex; c.nb_exclus = 1;
+    TEST("points de passage : obligatoire exclu = NULL",
+         chemin_points_passage(g, 0, 24, &c, 1, NULL) == NULL);
+    detruire_graphe(g);
+
+    /* Impasse obligatoire : la route repasse par 1, aucun chemin simple */
+    g = creer_graphe(4, 0);
+    for (int i = 0; i < 4; i++) ajouter_noeud(g, i, "N");
+    ajouter_arete(g, 0, 1, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 1, 2, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 1, 3, 1.0f, 100.0f, 1.0f, 5);
+    int feuille[1] = {2};
+    Contraintes cf = {0.0f, 100.0f, 0, feuille, 1, NULL, 0};
+    ch = chemin_points_passage(g, 0, 3, &cf, 1, &sp);
+    TEST("impasse : route 0-1-2-1-3 non simple",
+         ch && ch->longueur == 5 && ch->latence_totale == 4.0f && !sp.chemin_simple);
+    TEST("impasse : aucun chemin simple pour le backtracking",
+         chemin_contraint_backtracking(g, 0, 3, &cf) == NULL);
+    detruire_chemin(ch);
+    Contraintes vide = {0.0f, 100.0f, 0, NULL, 0, NULL, 0};
+    ch = chemin_points_passage(g, 1, 1, &vide, 1, NULL);
+    TEST("source = destination : securite SECURITE_MAX",
+         ch && ch->longueur == 1 && ch->securite_min == SECURITE_MAX);
+    detruire_chemin(ch);
+    detruire_graphe(g);
+
+    /* Chaine non orientee, plus de PASSAGE_EXACT_MAX points : ordre heuristique */
+    int n = 60, k = PASSAGE_EXACT_MAX + 7;
+    g = creer_graphe(n, 0);
+    for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i + 1 < n; i++) ajouter_arete(g, i, i + 1, 1.0f, 100.0f, 1.0f, 5);
+    int* pts = (int*)malloc(k * sizeof(int));
+    for (int i = 0; i < k; i++) pts[i] = 1 + (i * 37) % (n - 2);
+    Contraintes cc = {0.0f, 1000.0f, 0, pts, k, NULL, 0};
+    ch = chemin_points_passage(g, 0, n - 1, &cc, 0, &sp);
+    TEST("heuristique au-dela de PASSAGE_EXACT_MAX",
+         ch && !sp.ordre_exact && sp.nb_points == k);
+    TEST("heuristique : chaine parcourue une fois",
+         ch && sp.chemin_simple && ch->longueur == n && ch->latence_totale == (float)(n - 1));
+    detruire_chemin(ch);
+    free(pts);
+    detruire_graphe(g);
+}
+
+void test_etiquettes(void) {
+    printf("\n--- Routage contraint : etiquettes ---\n");
+
+    /* 0->1->3 : lat 10, cout 20 | 0->2->3 : lat 30, cout 4 */
+    Graphe* g = creer_graphe(4, 1);
+    for (int i = 0; i < 4; i++) ajouter_noeud(g, i, "N");
+    ajouter_arete(g, 0, 1, 5.0f, 100.0f, 10.0f, 8);
+    ajouter_arete(g, 1, 3, 5.0f, 100.0f, 10.0f, 8);
+    ajouter_arete(g, 0, 2, 15.0f, 60.0f, 2.0f, 6);
+    ajouter_arete(g, 2, 3, 15.0f, 90.0f, 2.0f, 7);
+
+    Contraintes c = {0.0f, 100.0f, 0, NULL, 0, NULL, 0};
+    Chemin* ch = chemin_contraint_etiquettes(g, 0, 3, &c);
+    TEST("budget large : latence 10", ch && ch->latence_totale == 10.0f);
+    detruire_chemin(ch);
+
+    c.cout_max_autorise = 5.0f;
+    ch = chemin_contraint_etiquettes(g, 0, 3, &c);
+    TEST("budget serre : latence 30", ch && ch->latence_totale == 30.0f);
+    TEST("budget serre : cout 4, bw 60, sec 6",
+         ch && ch->cout_total == 4.0f && ch->bw_minimale == 60.0f && ch->securite_min == 6);
+    detruire_chemin(ch);
+
+    c.cout_max_autorise = 3.0f;
+    TEST("budget impossible = NULL", chemin_contraint_etiquettes(g, 0, 3, &c) == NULL);
+    detruire_graphe(g);
+
+    /* Comparaison avec le backtracking exhaustif */
+    int identiques = 1;
+    for (unsigned graine = 1; graine <= 20; graine++) {
+        Graphe* r = graphe_aleatoire(12, 40, graine);
+        int excl[1] = { (int)(graine % 12) };
+        Contraintes cr = {30.0f, 15.0f, 3, NULL, 0, excl, graine % 2};
+        Chemin* b = chemin_contraint_backtracking(r, 0, 11, &cr);
+        Chemin* e = chemin_contraint_etiquettes(r, 0, 11, &cr);
+        if ((b == NULL) != (e == NULL)) identiques = 0;
+        else if (b && (b->latence_totale != e->latence_totale || e->cout_total > 15.0f))
+            identiques = 0;
+        detruire_chemin(b); detruire_chemin(e);
+        detruire_graphe(r);
+    }
+    TEST("etiquettes = backtracking (20 graphes)", identiques);
+}
+
+void test_front_pareto(void) {
+    printf("\n--- Routage multi-objectif : front de Pareto ---\n");
+
+    /* Trois routes 0 -> 3 :
+         via 1 : lat 10, cout 20, sec 8
+         via 2 : lat 30, cout  4, sec 6
+         via 4 : lat 40, cout 25, sec 5  (dominee par la route via 1) */
+    Graphe* g = creer_graphe(5, 1);
+    for (int i = 0; i < 5; i++) ajouter_noeud(g, i, "N");
+    ajouter_arete(g, 0, 1, 5.0f, 100.0f, 10.0f, 8);
+    ajouter_arete(g, 1, 3, 5.0f, 100.0f, 10.0f, 9);
+    ajouter_arete(g, 0, 2, 15.0f, 100.0f, 2.0f, 6);
+    ajouter_arete(g, 2, 3, 15.0f, 100.0f, 2.0f, 7);
+    ajouter_arete(g, 0, 4, 20.0f, 100.0f, 5.0f, 5);
+    ajouter_arete(g, 4, 3, 20.0f, 100.0f, 20.0f, 9);
+
+    int nb = 0, tronque = 1;
+    Chemin* front = front_pareto(g, 0, 3, NULL, NULL, &nb, &tronque);
+    TEST("front : 2 chemins non domines", nb == 2);
+    TEST("front trie par latence", front && front->latence_totale == 10.0f &&
+         front->suivant && front->suivant->latence_totale == 30.0f);
+    TEST("front : securite et cout renseignes",
+         front && front->securite_min == 8 && front->suivant->cout_total == 4.0f);
+    TEST("front exact non tronque", tronque == 0);
+    detruire_liste_chemins(front);
+
+    /* Plafond d'une etiquette par noeud : approximation signalee */
+    OptionsPareto opt = {1, 0, 0.0f, 1};
+    front = front_pareto(g, 0, 3, NULL, &opt, &nb, &tronque);
+    TEST("plafond : au plus 1 chemin, tronque", nb == 1 && tronque == 1);
+    detruire_liste_chemins(front);
+    detruire_graphe(g);
+
+    /* Parallele = sequentiel, et chaque point du front est non domine */
+    Graphe* r = graphe_aleatoire(60, 400, 7);
+    OptionsPareto seq = {0, 0, 0.0f, 1}, par = {0, 0, 0.0f, 4};
+    int n1 = 0, n2 = 0;
+    Chemin* f1 = front_pareto(r, 0, 59, NULL, &seq, &n1, NULL);
+    Chemin* f2 = front_pareto(r, 0, 59, NULL, &par, &n2, NULL);
+    int ok = (n1 == n2 && n1 > 0);
+    for (Chemin* a = f1, *b = f2; ok && a && b; a = a->suivant, b = b->suivant)
+        ok = a->latence_totale == b->latence_totale && a->cout_total == b->cout_total;
+    for (Chemin* a = f1; ok && a; a = a->suivant)
+        for (Chemin* b = f1; ok && b; b = b->suivant)
+            if (a != b && b->latence_totale <= a->latence_totale &&
+                b->cout_total <= a->cout_total && b->securite_min >= a->securite_min)
+                ok = 0;
+    TEST("front parallele = sequentiel, sans domination", ok);
+
+    OptionsPareto eps = {0, 0, 0.2f, 0};
+    int n3 = 0;
+    Chemin* f3 = front_pareto(r, 0, 59, NULL, &eps, &n3, NULL);
+    TEST("epsilon-dominance : front plus petit", n3 > 0 && n3 <= n1);
+    detruire_liste_chemins(f1); detruire_liste_chemins(f2); detruire_liste_chemins(f3);
+    detruire_graphe(r);
+}
+
 /* ============================================================
  *  TESTS MODULE 3 : SÉCURITÉ
  * ============================================================ */
 
+/* Deux numerotations decrivent les memes composantes (bijection) */
+static int meme_partition(const int* a, const int* b, int n) {
+    int* vers_b = (int*)malloc(n * sizeof(int));
+    int* vers_a = (int*)malloc(n * sizeof(int));
+    int ok = 1;
+    for (int i = 0; i < n; i++) vers_b[i] = vers_a[i] = -1;
+    for (int v = 0; v < n && ok; v++) {
+        if (a[v] < 0 || b[v] < 0) { ok = (a[v] == b[v]); continue; }
+        if (vers_b[a[v]] < 0 && vers_a[b[v]] < 0) { vers_b[a[v]] = b[v]; vers_a[b[v]] = a[v]; }
+        ok = (vers_b[a[v]] == b[v] && vers_a[b[v]] == a[v]);
+    }
+    free(vers_b); free(vers_a);
+    return ok;
+}
+
 void test_securite(void) {
     printf("\n--- Module 3 : Securite ---\n");
 
@@ -114,6 +605,725 @@ void test_securite(void) {
     TEST("cycle detecte apres ajout", detecter_cycle(g) == 1);
 
     detruire_graphe(g);
+
+    /* Longue chaine non orientee : parcours a pile explicite */
+    int n = 2000;
+    g = creer_graphe(n, 0);
+    for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i + 1 < n; i++) ajouter_arete(g, i, i + 1, 1.0f, 100.0f, 1.0f, 5);
+    int* ordre = (int*)malloc(n * sizeof(int));
+    int nb = 0;
+    dfs(g, 0, ordre, &nb);
+    TEST("DFS iteratif : chaine parcourue dans l'ordre",
+         nb == n && ordre[0] == 0 && ordre[n - 1] == n - 1);
+    ResultatSecurite res = {0};
+    trouver_points_articulation(g, &res);
+    TEST("chaine : n-2 points d'articulation, n-1 ponts",
+         res.nb_points_articulation == n - 2 && res.nb_ponts == n - 1);
+    TEST("chaine : premier pont ferme en dernier",
+         res.nb_ponts > 0 && res.ponts[2 * res.nb_ponts - 2] == 0 &&
+         res.ponts[2 * res.nb_ponts - 1] == 1);
+    free(res.ponts); free(res.points_articulation);
+    free(ordre);
+    detruire_graphe(g);
+
+    /* Chaine orientee bouclee : une seule composante fortement connexe */
+    g = creer_graphe(n, 1);
+    for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i + 1 < n; i++) ajouter_arete(g, i, i + 1, 1.0f, 100.0f, 1.0f, 5);
+    tarjan_scc(g, &res);
+    TEST("Tarjan iteratif : n composantes sans retour", res.nb_composantes == n);
+    free(res.composantes);
+    ajouter_arete(g, n - 1, 0, 1.0f, 100.0f, 1.0f, 5);
+    tarjan_scc(g, &res);
+    TEST("Tarjan iteratif : une composante avec retour",
+         res.nb_composantes == 1 && detecter_cycle(g) == 1);
+    free(res.composantes);
+    detruire_graphe(g);
+
+    /* Analyse fusionnee : deux triangles relies par le pont 2 - 3 */
+    g = creer_graphe(6, 0);
+    for (int i = 0; i < 6; i++) ajouter_noeud(g, i, "N");
+    int tri[7][2] = {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 5}, {5, 3}};
+    for (int i = 0; i < 7; i++) ajouter_arete(g, tri[i][0], tri[i][1], 1.0f, 100.0f, 1.0f, 5);
+    ResultatSecurite* r = analyser_securite(g);
+    ResultatSecurite seul = {0};
+    trouver_ponts(g, &seul);
+    TEST("analyse fusionnee : pont 2-3, articulations 2 et 3",
+         r->nb_ponts == 1 && r->ponts[0] == 2 && r->ponts[1] == 3 &&
+         r->nb_points_articulation == 2 && r->points_articulation[0] == 2 &&
+         r->points_articulation[1] == 3);
+    TEST("analyse fusionnee : cycle, une SCC, durees renseignees",
+         r->a_cycle == 1 && r->nb_composantes == 1 &&
+         r->temps_parcours_ms >= 0.0 && r->temps_collecte_ms >= 0.0);
+    TEST("trouver_ponts seul = analyse complete",
+         seul.nb_ponts == 1 && seul.ponts[0] == 2 && seul.ponts[1] == 3 &&
+         seul.points_articulation == NULL);
+    free(seul.ponts);
+    detruire_resultat_securite(r);
+    detruire_graphe(g);
+
+    /* SCC paralleles : meme partition que Tarjan, noeud inactif ignore */
+    g = graphe_aleatoire(400, 700, 11);
+    supprimer_noeud(g, 7);
+    ResultatSecurite tj = {0}, p1 = {0}, p4 = {0};
+    tarjan_scc(g, &tj);
+    scc_parallele(g, &p1, 1);
+    scc_parallele(g, &p4, 4);
+    TEST("SCC paralleles : meme nombre que Tarjan",
+         p1.nb_composantes == tj.nb_composantes && p4.nb_composantes == tj.nb_composantes &&
+         tj.nb_composantes > 1 && tj.nb_composantes < 399);
+    TEST("SCC paralleles : meme partition, independante des threads",
+         meme_partition(tj.composantes, p1.composantes, 400) &&
+         memcmp(p1.composantes, p4.composantes, 400 * sizeof(int)) == 0 &&
+         p1.composantes[7] == -1);
+    free(tj.composantes); free(p1.composantes); free(p4.composantes);
+
+    /* BFS a direction optimisee : memes noeuds que le DFS, niveaux croissants */
+    int ob[400], od[400], nb_b = 0, nb_d = 0, s0 = 0;
+    for (; s0 < 400 && nb_d <= 100; s0++)
+        if (noeud_existe(g, s0)) dfs(g, s0, od, &nb_d);
+    s0--;
+    bfs(g, s0, ob, &nb_b);
+    int* niveau = (int*)malloc(400 * sizeof(int));
+    for (int i = 0; i < 400; i++) niveau[i] = -1;
+    niveau[s0] = 0;
+    int niveaux_ok = (nb_b > 0 && ob[0] == s0);
+    for (int i = 1; i < nb_b && niveaux_ok; i++) {
+        /* Le niveau de ob[i] = 1 + plus petit niveau d'un predecesseur deja vu */
+        for (int j = 0; j < i; j++) {
+            Arete* a = trouver_arete(g, ob[j], ob[i]);
+            if (a && (niveau[ob[i]] < 0 || niveau[ob[j]] + 1 < niveau[ob[i]]))
+                niveau[ob[i]] = niveau[ob[j]] + 1;
+        }
+        niveaux_ok = niveau[ob[i]] >= niveau[ob[i - 1]];
+    }
+    TEST("BFS : memes noeuds atteints que le DFS", nb_b == nb_d && nb_b > 100);
+    TEST("BFS : noeuds ranges par niveau", niveaux_ok);
+    free(niveau);
+    detruire_graphe(g);
+
+    /* Connexite par BFS : chaine non orientee coupee puis reparee */
+    g = creer_graphe(50, 0);
+    for (int i = 0; i < 50; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i + 1 < 50; i++) ajouter_arete(g, i, i + 1, 1.0f, 100.0f, 1.0f, 5);
+    TEST("connexite : chaine connexe", graphe_est_connexe(g) == 1);
+    supprimer_arete(g, 24, 25);
+    TEST("connexite : chaine coupee", graphe_est_connexe(g) == 0);
+    ajouter_arete(g, 0, 49, 1.0f, 100.0f, 1.0f, 5);
+    TEST("connexite : reparee par un autre arc", graphe_est_connexe(g) == 1);
+    detruire_graphe(g);
+}
+
+/* Composantes apres retrait du noeud panne : etiquette = premier noeud atteint */
+static void composantes_sans(const Graphe* g, int panne, int* etiquette, int* file) {
+    int n = g->capacite_max;
+    for (int i = 0; i < n; i++) etiquette[i] = -1;
+    for (int s = 0; s < n; s++) {
+        if (s == panne || !noeud_existe(g, s) || etiquette[s] >= 0) continue;
+        int tete = 0, queue = 0;
+        etiquette[s] = s;
+        file[queue++] = s;
+        while (tete < queue) {
+            int u = file[tete++];
+            for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+                if (a->destination == panne || etiquette[a->destination] >= 0) continue;
+                etiquette[a->destination] = s;
+                file[queue++] = a->destination;
+            }
+        }
+    }
+}
+
+void test_arbre_blocs(void) {
+    printf("\n--- Arbre des blocs (pannes) ---\n");
+
+    /* Triangles 0-1-2 et 3-4-5 relies par 2-3, noeud 6 pendu a 5 */
+    Graphe* g = creer_graphe(7, 0);
+    for (int i = 0; i < 7; i++) ajouter_noeud(g, i, "N");
+    int ar[8][2] = {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 5}, {5, 3}, {5, 6}};
+    for (int i = 0; i < 8; i++) ajouter_arete(g, ar[i][0], ar[i][1], 1.0f, 100.0f, 1.0f, 5);
+    ArbreBlocs* ab = construire_arbre_blocs(g);
+    TEST("arbre des blocs : 4 blocs, 3 points d'articulation",
+         ab->nb_blocs == 4 && ab->nb_noeuds_arbre == 7);
+    TEST("panne de 2 : 0 et 4 separes, 0 et 1 relies",
+         connectes_apres_panne(ab, 0, 4, 2) == 0 && connectes_apres_panne(ab, 0, 1, 2) == 1);
+    TEST("panne d'un noeud non critique ou aucune panne",
+         connectes_apres_panne(ab, 0, 6, 1) == 1 && connectes_apres_panne(ab, 0, 6, -1) == 1 &&
+         connectes_apres_panne(ab, 0, 6, 6) == 0);
+    int out[7];
+    int nb = sommets_isoles_par_panne(ab, 2, 0, out);
+    int somme = 0;
+    for (int i = 0; i < nb; i++) somme += out[i];
+    TEST("panne de 2, coeur 0 : 3, 4, 5, 6 coupes", nb == 4 && somme == 18);
+    nb = sommets_isoles_par_panne(ab, 3, 6, out);
+    somme = 0;
+    for (int i = 0; i < nb; i++) somme += out[i];
+    TEST("panne de 3, coeur 6 : 0, 1, 2 coupes", nb == 3 && somme == 3);
+    TEST("panne de 5 coupe 6 ; panne de 0 ne coupe rien ; panne = coeur refuse",
+         sommets_isoles_par_panne(ab, 5, 0, out) == 1 && out[0] == 6 &&
+         sommets_isoles_par_panne(ab, 0, 4, NULL) == 0 &&
+         sommets_isoles_par_panne(ab, 4, 4, NULL) == -1);
+    detruire_arbre_blocs(ab);
+    detruire_graphe(g);
+
+    /* Graphe oriente 0->1, 2->1, 1->3 : vue non orientee, 1 coupe 0, 2 et 3 */
+    g = creer_graphe(4, 1);
+    for (int i = 0; i < 4; i++) ajouter_noeud(g, i, "N");
+    ajouter_arete(g, 0, 1, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 2, 1, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 1, 3, 1.0f, 100.0f, 1.0f, 5);
+    ab = construire_arbre_blocs(g);
+    TEST("oriente : 0 et 2 relies sans panne, separes par la panne de 1",
+         connectes_apres_panne(ab, 0, 2, -1) == 1 && connectes_apres_panne(ab, 0, 2, 1) == 0);
+    nb = sommets_isoles_par_panne(ab, 1, 0, out);
+    somme = 0;
+    for (int i = 0; i < nb; i++) somme += out[i];
+    TEST("oriente : panne de 1, coeur 0 : 2 et 3 coupes", nb == 2 && somme == 5);
+    detruire_arbre_blocs(ab);
+    detruire_graphe(g);
+
+    /* Graphes aleatoires : toutes les pannes, toutes les paires, contre un BFS */
+    int n = 60, ok = 1, coupes_ok = 1;
+    int* etiq  = (int*)malloc(n * sizeof(int));
+    int* etiq0 = (int*)malloc(n * sizeof(int));
+    int* file  = (int*)malloc(n * sizeof(int));
+    int* sortie = (int*)malloc(n * sizeof(int));
+    for (int essai = 0; essai < 4; essai++) {
+        srand(100 + essai);
+        g = creer_graphe(n, 0);
+        for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+        for (int i = 0; i < 60 + 20 * essai; i++) {
+            int u = rand_entre(0, n - 1), v = rand_entre(0, n - 1);
+            if (u != v) ajouter_arete(g, u, v, 1.0f, 100.0f, 1.0f, 5);
+        }
+        /* Essais impairs : memes liens en oriente, compares a la reference non orientee */
+        Graphe* go = NULL;
+        if (essai % 2) {
+            srand(100 + essai);
+            go = creer_graphe(n, 1);
+            for (int i = 0; i < n; i++) ajouter_noeud(go, i, "N");
+            for (int i = 0; i < 60 + 20 * essai; i++) {
+                int u = rand_entre(0, n - 1), v = rand_entre(0, n - 1);
+                if (u != v) ajouter_arete(go, u, v, 1.0f, 100.0f, 1.0f, 5);
+            }
+        }
+        ab = construire_arbre_blocs(go ? go : g);
+        composantes_sans(g, -1, etiq0, file);
+        for (int x = 0; x < n; x++) {
+            composantes_sans(g, x, etiq, file);
+            for (int u = 0; u < n; u++)
+                for (int v = 0; v < n; v++)
+                    if (connectes_apres_panne(ab, u, v, x) != (u != x && v != x && etiq[u] == etiq[v]))
+                        ok = 0;
+            int coeur = (x + 1) % n, attendu = 0;
+            for (int v = 0; v < n; v++)
+                if (v != x && etiq0[v] == etiq0[coeur] && etiq[v] != etiq[coeur]) attendu++;
+            nb = sommets_isoles_par_panne(ab, x, coeur, sortie);
+            for (int i = 0; i < nb; i++) if (etiq[sortie[i]] == etiq[coeur]) coupes_ok = 0;
+            if (nb != attendu) coupes_ok = 0;
+        }
+        detruire_arbre_blocs(ab);
+        detruire_graphe(g);
+        detruire_graphe(go);
+    }
+    TEST("pannes aleatoires : connexite identique au BFS sans le noeud", ok);
+    TEST("pannes aleatoires : noeuds coupes du coeur identiques", coupes_ok);
+    free(etiq); free(etiq0); free(file); free(sortie);
+}
+
+/* atteint[v] = 1 si v est atteignable depuis s (BFS oriente) */
+static void atteignables_depuis(const Graphe* g, int s, char* atteint, int* file) {
+    int n = g->capacite_max, tete = 0, queue = 0;
+    for (int i = 0; i < n; i++) atteint[i] = 0;
+    atteint[s] = 1;
+    file[queue++] = s;
+    while (tete < queue) {
+        int u = file[tete++];
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            if (atteint[a->destination]) continue;
+            atteint[a->destination] = 1;
+            file[queue++] = a->destination;
+        }
+    }
+}
+
+void test_index_accessibilite(void) {
+    printf("\n--- Index d'accessibilite (DAG des SCC) ---\n");
+
+    /* Cycle 0-1-2 -> 3 -> cycle 4-5, et 6 isole */
+    Graphe* g = creer_graphe(7, 1);
+    for (int i = 0; i < 7; i++) ajouter_noeud(g, i, "N");
+    int ar[7][2] = {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 5}, {5, 4}};
+    for (int i = 0; i < 7; i++) ajouter_arete(g, ar[i][0], ar[i][1], 1.0f, 100.0f, 1.0f, 5);
+    for (int mode = 0; mode < 2; mode++) {
+        IndexAccessibilite* idx = construire_index_accessibilite(g, mode == 0 ? 0 : 1);
+        TEST(mode == 0 ? "fermeture : 4 SCC, 2 arcs dans le DAG" : "GRAIL : 4 SCC, 2 arcs dans le DAG",
+             idx->nb_composantes == 4 && idx->nb_arcs_dag == 2 &&
+             (mode == 0) == (idx->fermeture != NULL));
+        TEST("1 atteint 5 et 0 (meme SCC), 5 n'atteint pas 3, 6 isole",
+             peut_atteindre(idx, 1, 5) && peut_atteindre(idx, 1, 0) &&
+             !peut_atteindre(idx, 5, 3) && !peut_atteindre(idx, 0, 6) && peut_atteindre(idx, 6, 6));
+        int a[2] = {3, 6}, b[2] = {0, 5}, c[1] = {2};
+        TEST("zones : {3,6} atteint {0,5}, {3,6} n'atteint pas {2}",
+             zone_peut_atteindre(idx, a, 2, b, 2) && !zone_peut_atteindre(idx, a, 2, c, 1));
+        detruire_index_accessibilite(idx);
+    }
+    detruire_graphe(g);
+
+    /* Graphes aleatoires : toutes les paires contre un BFS, deux modes */
+    int n = 150, ok = 1, zones_ok = 1;
+    char* atteint = (char*)malloc(n * n);
+    int* file = (int*)malloc(n * sizeof(int));
+    for (int essai = 0; essai < 4; essai++) {
+        srand(300 + essai);
+        g = creer_graphe(n, 1);
+        for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+        for (int i = 0; i < n + 40 * essai; i++) {
+            int u = rand_entre(0, n - 1), v = rand_entre(0, n - 1);
+            if (u != v) ajouter_arete(g, u, v, 1.0f, 100.0f, 1.0f, 5);
+        }
+        for (int u = 0; u < n; u++) atteignables_depuis(g, u, atteint + u * n, file);
+        for (int mode = 0; mode < 2; mode++) {
+            IndexAccessibilite* idx = construire_index_accessibilite(g, mode == 0 ? 0 : 1);
+            for (int u = 0; u < n; u++)
+                for (int v = 0; v < n; v++)
+                    if (peut_atteindre(idx, u, v) != atteint[u * n + v]) ok = 0;
+            for (int k = 0; k < 50; k++) {
+                int za[3], zb[3], attendu = 0;
+                for (int i = 0; i < 3; i++) { za[i] = rand_entre(0, n - 1); zb[i] = rand_entre(0, n - 1); }
+                for (int i = 0; i < 3; i++)
+                    for (int j = 0; j < 3; j++) attendu |= atteint[za[i] * n + zb[j]];
+                if (zone_peut_atteindre(idx, za, 3, zb, 3) != attendu) zones_ok = 0;
+            }
+            detruire_index_accessibilite(idx);
+        }
+        detruire_graphe(g);
+    }
+    TEST("accessibilite aleatoire : identique au BFS (fermeture et GRAIL)", ok);
+    TEST("zones aleatoires : identique au BFS", zones_ok);
+    free(atteint); free(file);
+}
+
+/* Reference O(n^3) : d[s][v] et nombre de plus courts chemins sg[s][v] */
+static void chemins_reference(const Graphe* g, int pondere, double* d, double* sg) {
+    int n = g->capacite_max;
+    int* ordre = (int*)malloc(n * sizeof(int));
+    for (int s = 0; s < n; s++) {
+        double* ds = d + s * n;
+        for (int v = 0; v < n; v++) ds[v] = 1e30;
+        ds[s] = 0.0;
+        for (int k = 0; k < n; k++)         /* Bellman-Ford */
+            for (int u = 0; u < n; u++)
+                for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+                    double l = pondere ? a->latence : 1.0;
+                    if (ds[u] + l < ds[a->destination]) ds[a->destination] = ds[u] + l;
+                }
+        for (int v = 0; v < n; v++) ordre[v] = v;
+        for (int i = 1; i < n; i++)         /* Tri par distance croissante */
+            for (int j = i; j > 0 && ds[ordre[j]] < ds[ordre[j - 1]]; j--) {
+                int x = ordre[j]; ordre[j] = ordre[j - 1]; ordre[j - 1] = x;
+            }
+        double* ss = sg + s * n;
+        for (int v = 0; v < n; v++) ss[v] = (v == s);
+        for (int i = 0; i < n; i++) {
+            int u = ordre[i];
+            for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant)
+                if (ds[u] + (pondere ? a->latence : 1.0) == ds[a->destination])
+                    ss[a->destination] += ss[u];
+        }
+    }
+    free(ordre);
+}
+
+void test_centralite(void) {
+    printf("\n--- Centralite d'intermediarite (Brandes) ---\n");
+
+    /* Chemin 0-1-2-3 et etoile 4 -> {5, 6, 7} (non oriente) */
+    Graphe* g = creer_graphe(8, 0);
+    for (int i = 0; i < 8; i++) ajouter_noeud(g, i, "N");
+    int ar[6][2] = {{0, 1}, {1, 2}, {2, 3}, {4, 5}, {4, 6}, {4, 7}};
+    for (int i = 0; i < 6; i++) ajouter_arete(g, ar[i][0], ar[i][1], 1.0f, 100.0f, 1.0f, 5);
+    ResultatCentralite* rc = centralite_intermediarite(g, CENTRALITE_NON_PONDEREE, 1);
+    TEST("chemin : 1 et 2 valent 2, extremites 0 ; centre d'etoile 3",
+         rc->noeuds[1] == 2.0 && rc->noeuds[2] == 2.0 && rc->noeuds[0] == 0.0 &&
+         rc->noeuds[4] == 3.0 && rc->classement[0] == 4);
+    TEST("liens : 1-2 en tete (4 paires), 6 liens",
+         rc->nb_liens == 6 && rc->liens[0] == 1 && rc->liens[1] == 2 &&
+         rc->centralite_liens[0] == 4.0);
+    detruire_centralite(rc);
+    ResultatSecurite* r = analyser_securite(g);
+    TEST("analyse de base : pas de centralite", r->centralite == NULL);
+    detruire_resultat_securite(r);
+    r = analyser_securite_approfondie(g);
+    TEST("analyse approfondie : classement inclus", r->centralite && r->centralite->classement[0] == 4);
+    detruire_resultat_securite(r);
+    detruire_graphe(g);
+
+    /* Graphes aleatoires (latences entieres : sommes exactes) contre la reference */
+    int n = 30, ok = 1, ok_liens = 1, ok_threads = 1;
+    double* d  = (double*)malloc(n * n * sizeof(double));
+    double* sg = (double*)malloc(n * n * sizeof(double));
+    for (int essai = 0; essai < 4; essai++) {
+        srand(400 + essai);
+        int oriente = essai & 1, pondere = essai >> 1;
+        g = creer_graphe(n, oriente);
+        for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+        for (int i = 0; i < 3 * n; i++) {
+            int u = rand_entre(0, n - 1), v = rand_entre(0, n - 1);
+            if (u != v && !trouver_arete(g, u, v))
+                ajouter_arete(g, u, v, (float)rand_entre(1, 4), 100.0f, 1.0f, 5);
+        }
+        int mode = pondere ? CENTRALITE_LATENCE : CENTRALITE_NON_PONDEREE;
+        rc = centralite_intermediarite(g, mode, 1);
+        ResultatCentralite* rc3 = centralite_intermediarite(g, mode, 3);
+        chemins_reference(g, pondere, d, sg);
+        double facteur = oriente ? 1.0 : 0.5;
+        for (int v = 0; v < n; v++) {
+            double attendu = 0.0;
+            for (int s = 0; s < n; s++)
+                for (int t = 0; t < n; t++)
+                    if (s != v && t != v && s != t && sg[s * n + t] > 0.0 &&
+                        d[s * n + v] + d[v * n + t] == d[s * n + t])
+                        attendu += sg[s * n + v] * sg[v * n + t] / sg[s * n + t];
+            if (fabs(rc->noeuds[v] - attendu * facteur) > 1e-6) ok = 0;
+            if (fabs(rc3->noeuds[v] - rc->noeuds[v]) > 1e-6) ok_threads = 0;
+        }
+        for (int i = 0; i < rc->nb_liens; i++) {
+            int u = rc->liens[2 * i], x = rc->liens[2 * i + 1];
+            double attendu = 0.0;
+            for (int sens = 0; sens < (oriente ? 1 : 2); sens++) {
+                int a = sens ? x : u, b = sens ? u : x;
+                double l = pondere ? trouver_arete(g, a, b)->latence : 1.0;
+                for (int s = 0; s < n; s++)
+                    for (int t = 0; t < n; t++)
+                        if (s != t && sg[s * n + t] > 0.0 && d[s * n + a] + l + d[b * n + t] == d[s * n + t])
+                            attendu += sg[s * n + a] * sg[b * n + t] / sg[s * n + t];
+            }
+            if (fabs(rc->centralite_liens[i] - attendu * facteur) > 1e-6) ok_liens = 0;
+            if (i > 0 && rc->centralite_liens[i] > rc->centralite_liens[i - 1]) ok_liens = 0;
+        }
+        detruire_centralite(rc);
+        detruire_centralite(rc3);
+        detruire_graphe(g);
+    }
+    TEST("noeuds : identique au denombrement de reference (4 graphes)", ok);
+    TEST("liens : identique a la reference et classement decroissant", ok_liens);
+    TEST("1 thread et 3 threads : memes valeurs", ok_threads);
+    free(d); free(sg);
+}
+
+void test_voisinage(void) {
+    printf("\n--- Fonction de voisinage (HyperANF) ---\n");
+
+    /* Chaine orientee 0 -> 1 -> ... -> 5 : petits ensembles, quasi exacts */
+    Graphe* g = creer_graphe(6, 1);
+    for (int i = 0; i < 6; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i < 5; i++) ajouter_arete(g, i, i + 1, 1.0f, 100.0f, 1.0f, 5);
+    ResultatVoisinage* rv = estimer_voisinage(g, 12, 1);
+    int ok = rv->nb_iterations == 5;
+    for (int t = 0; ok && t <= 5; t++) {
+        double attendu = 0.0;
+        for (int v = 0; v < 6; v++) attendu += (t + 1 < 6 - v) ? t + 1 : 6 - v;
+        ok = fabs(rv->fonction[t] - attendu) < 0.05 * attendu;
+    }
+    TEST("chaine : 5 tours, N(t) a 5 % pres", ok);
+    TEST("chaine : distance moyenne 7/3, noeud 5 sans successeur",
+         fabs(rv->distance_moyenne - 7.0 / 3.0) < 0.1 && rv->proximite[5] == 0.0 &&
+         fabs(rv->harmonique[0] - (1 + 1.0 / 2 + 1.0 / 3 + 1.0 / 4 + 1.0 / 5)) < 0.1);
+    detruire_voisinage(rv);
+    ResultatSecurite* r = analyser_securite(g);
+    TEST("analyse de base : pas de voisinage", r->voisinage == NULL);
+    detruire_resultat_securite(r);
+    r = analyser_securite_approfondie(g);
+    TEST("analyse approfondie : voisinage inclus", r->voisinage && r->voisinage->nb_iterations == 5);
+    detruire_resultat_securite(r);
+    detruire_graphe(g);
+
+    /* Graphe aleatoire : mesures contre des BFS exacts, 1 et 3 threads */
+    int n = 1200;
+    srand(500);
+    g = creer_graphe(n, 0);
+    for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i < 2 * n; i++) {
+        int u = rand_entre(0, n - 1), v = rand_entre(0, n - 1);
+        if (u != v) ajouter_arete(g, u, v, 1.0f, 100.0f, 1.0f, 5);
+    }
+    int* dist = (int*)malloc(n * sizeof(int));
+    int* file = (int*)malloc(n * sizeof(int));
+    double paires = 0.0, somme = 0.0;
+    int diametre = 0;
+    for (int s = 0; s < n; s++) {
+        for (int v = 0; v < n; v++) dist[v] = -1;
+        int tete = 0, queue = 0;
+        dist[s] = 0;
+        file[queue++] = s;
+        while (tete < queue) {
+            int u = file[tete++];
+            for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+                if (dist[a->destination] >= 0) continue;
+                dist[a->destination] = dist[u] + 1;
+                file[queue++] = a->destination;
+                paires += 1.0;
+                somme += dist[u] + 1;
+                if (dist[u] + 1 > diametre) diametre = dist[u] + 1;
+            }
+        }
+    }
+    ResultatVoisinage* r1 = estimer_voisinage(g, 0, 1);
+    ResultatVoisinage* r3 = estimer_voisinage(g, 0, 3);
+    int memes = r1->nb_iterations == r3->nb_iterations;
+    for (int t = 0; memes && t <= r1->nb_iterations; t++) memes = r1->fonction[t] == r3->fonction[t];
+    for (int v = 0; memes && v < n; v++) memes = r1->proximite[v] == r3->proximite[v];
+    TEST("1 thread et 3 threads : resultats identiques", memes);
+    TEST("paires reliees a 25 % pres, diametre non surestime",
+         fabs(r1->paires_atteignables - paires) < 0.25 * paires && r1->nb_iterations <= diametre);
+    TEST("distance moyenne a 5 % pres", fabs(r1->distance_moyenne - somme / paires) < 0.05 * somme / paires);
+    detruire_voisinage(r1);
+    detruire_voisinage(r3);
+    free(dist); free(file);
+    detruire_graphe(g);
+}
+
+/* t atteint depuis s sans les noeuds retires, ni les arcs retires, ni
+ * (si sans_direct) les arcs s -> t ; arcs retires : masque u * n + v */
+static int atteint_sans(const Graphe* g, int s, int t, const char* retire,
+                        const char* arc_retire, int sans_direct, int* file) {
+    int n = g->capacite_max, tete = 0, queue = 0;
+    char* vu = (char*)calloc(n, 1);
+    vu[s] = 1;
+    file[queue++] = s;
+    while (tete < queue) {
+        int u = file[tete++];
+        for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+            int v = a->destination;
+            if (vu[v] || (retire && retire[v]) || (arc_retire && arc_retire[u * n + v]) ||
+                (sans_direct && u == s && v == t)) continue;
+            vu[v] = 1;
+            file[queue++] = v;
+        }
+    }
+    int ok = vu[t];
+    free(vu);
+    return ok;
+}
+
+/* Coupes par enumeration des sous-ensembles (petits graphes) */
+static int lambda_reference(const Graphe* g, int s, int t, int symetrique) {
+    int n = g->capacite_max, meilleur = 1 << 30;
+    for (int masque = 0; masque < (1 << n); masque++) {
+        if (!(masque >> s & 1) || (masque >> t & 1)) continue;
+        int c = 0;
+        for (int u = 0; u < n; u++)
+            for (Arete* a = g->noeuds[u].aretes; a; a = a->suivant) {
+                int du = masque >> u & 1, dv = masque >> a->destination & 1;
+                if ((du && !dv) || (symetrique && !du && dv)) c++;
+            }
+        if (c < meilleur) meilleur = c;
+    }
+    return meilleur;
+}
+
+static int kappa_reference(const Graphe* g, int s, int t, int* file) {
+    int n = g->capacite_max, meilleur = n, directs = 0;
+    for (Arete* a = g->noeuds[s].aretes; a; a = a->suivant) directs += (a->destination == t);
+    char* retire = (char*)calloc(n, 1);
+    for (int masque = 0; masque < (1 << n); masque++) {
+        if ((masque >> s & 1) || (masque >> t & 1)) continue;
+        int taille = 0;
+        for (int v = 0; v < n; v++) { retire[v] = masque >> v & 1; taille += retire[v]; }
+        if (taille < meilleur && !atteint_sans(g, s, t, retire, NULL, 1, file)) meilleur = taille;
+    }
+    free(retire);
+    return meilleur + directs;
+}
+
+void test_connectivite(void) {
+    printf("\n--- k-connexite et coupes minimales (flot max) ---\n");
+
+    /* Anneau 0..5 (non oriente) + corde 0-3 */
+    Graphe* g = creer_graphe(6, 0);
+    for (int i = 0; i < 6; i++) ajouter_noeud(g, i, "N");
+    for (int i = 0; i < 6; i++) ajouter_arete(g, i, (i + 1) % 6, 1.0f, 100.0f, 1.0f, 5);
+    ajouter_arete(g, 0, 3, 1.0f, 100.0f, 1.0f, 5);
+    CoupeMin c = {0};
+    TEST("anneau + corde : 3 chemins 0 -> 3, 2 chemins 1 -> 2",
+         connectivite_aretes(g, 0, 3, NULL) == 3 && connectivite_aretes(g, 1, 2, &c) == 2 && c.nb == 2);
+    liberer_coupe(&c);
+    int kappa = connectivite_noeuds(g, 1, 4, &c);
+    TEST("anneau + corde : 1 et 4 separes par 2 noeuds (dont 0)",
+         kappa == 2 && c.nb == 2 && (c.elements[0] == 0 || c.elements[1] == 0));
+    liberer_coupe(&c);
+    TEST("voisins 0-3 : lien direct + 2 chemins", connectivite_noeuds(g, 0, 3, NULL) == 3);
+    TEST("globale : 2-connexe en liens et en noeuds",
+         connectivite_globale_aretes(g, NULL) == 2 && connectivite_globale_noeuds(g, NULL) == 2);
+    int sites[3] = {0, 1, 3}, faibles[12];
+    TEST("redondance : 3 chemins de liens seulement pour 0-3",
+         verifier_redondance(g, sites, 3, 3, 0, faibles) == 2 &&
+         verifier_redondance(g, sites, 3, 2, 1, NULL) == 0);
+    TEST("parametres invalides", connectivite_aretes(g, 2, 2, NULL) == -1 &&
+         verifier_redondance(g, sites, 3, 0, 0, NULL) == -1);
+    detruire_graphe(g);
+
+    /* Graphes aleatoires de 8 noeuds contre l'enumeration des coupes */
+    int n = 8, ok_l = 1, ok_k = 1, ok_coupes = 1, ok_gh = 1, ok_glob = 1, ok_red = 1;
+    int* file = (int*)malloc(n * sizeof(int));
+    char* arcs = (char*)calloc(n * n, 1);
+    char* retire = (char*)calloc(n, 1);
+    for (int essai = 0; essai < 8; essai++) {
+        srand(600 + essai);
+        int oriente = essai & 1;
+        g = creer_graphe(n, oriente);
+        for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+        for (int i = 0; i < 10 + 2 * essai; i++) {
+            int u = rand_entre(0, n - 1), v = rand_entre(0, n - 1);
+            if (u != v && !trouver_arete(g, u, v)) ajouter_arete(g, u, v, 1.0f, 100.0f, 1.0f, 5);
+        }
+        ArbreCoupes* ac = construire_arbre_coupes(g);
+        int min_l = 1 << 30, min_k = n - 1, faibles_l = 0, faibles_k = 0;
+        for (int s = 0; s < n; s++)
+            for (int t = 0; t < n; t++) {
+                if (s == t) continue;
+                int l = lambda_reference(g, s, t, 0), k = kappa_reference(g, s, t, file);
+                if (l < min_l) min_l = l;
+                if (!trouver_arete(g, s, t) && k < min_k) min_k = k;
+                if ((oriente || s < t) && l < 2) faibles_l++;
+                if ((oriente || s < t) && k < 2) faibles_k++;
+                if (coupe_min_entre(ac, s, t) != lambda_reference(g, s, t, oriente)) ok_gh = 0;
+
+                if (connectivite_aretes(g, s, t, &c) != l) ok_l = 0;
+                memset(arcs, 0, n * n);
+                for (int i = 0; i < c.nb; i++) arcs[c.elements[2 * i] * n + c.elements[2 * i + 1]] = 1;
+                if (c.nb != l || atteint_sans(g, s, t, NULL, arcs, 0, file)) ok_coupes = 0;
+                liberer_coupe(&c);
+
+                if (connectivite_noeuds(g, s, t, &c) != k) ok_k = 0;
+                memset(retire, 0, n);
+                for (int i = 0; i < c.nb; i++) retire[c.elements[i]] = 1;
+                if (atteint_sans(g, s, t, retire, NULL, 1, file)) ok_coupes = 0;
+                liberer_coupe(&c);
+            }
+        if (connectivite_globale_aretes(g, &c) != min_l || c.nb != min_l) ok_glob = 0;
+        liberer_coupe(&c);
+        if (connectivite_globale_noeuds(g, NULL) != min_k) ok_glob = 0;
+        int tous[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+        if (verifier_redondance(g, tous, n, 2, 0, NULL) != faibles_l ||
+            verifier_redondance(g, tous, n, 2, 1, NULL) != faibles_k) ok_red = 0;
+        detruire_arbre_coupes(ac);
+        detruire_graphe(g);
+    }
+    TEST("aleatoire : lambda(s, t) identique a l'enumeration", ok_l);
+    TEST("aleatoire : kappa(s, t) identique a l'enumeration", ok_k);
+    TEST("aleatoire : chaque coupe renvoyee separe s de t", ok_coupes);
+    TEST("aleatoire : arbre de Gomory-Hu exact pour toutes les paires", ok_gh);
+    TEST("aleatoire : connexite globale en liens et en noeuds", ok_glob);
+    TEST("aleatoire : paires sous 2 chemins disjoints", ok_red);
+    free(file); free(arcs); free(retire);
+}
+
+/* Structure dynamique contre recalcul complet (graphe non oriente) */
+static int meme_securite_dynamique(SecuriteDynamique* sd, const Graphe* g) {
+    int n = g->capacite_max;
+    ResultatSecurite ref = {0}, dyn = {0};
+    trouver_points_articulation(g, &ref);
+    securite_dyn_resultat(sd, &dyn);
+    int ok = ref.nb_points_articulation == dyn.nb_points_articulation &&
+             ref.nb_ponts == dyn.nb_ponts;
+    for (int i = 0; ok && i < ref.nb_points_articulation; i++)
+        ok = ref.points_articulation[i] == dyn.points_articulation[i];
+    char* pont = (char*)calloc((size_t)n * n, sizeof(char));
+    for (int i = 0; i < ref.nb_ponts; i++) {
+        pont[ref.ponts[2 * i] * n + ref.ponts[2 * i + 1]] = 1;
+        pont[ref.ponts[2 * i + 1] * n + ref.ponts[2 * i]] = 1;
+    }
+    for (int i = 0; ok && i < dyn.nb_ponts; i++)
+        ok = pont[dyn.ponts[2 * i] * n + dyn.ponts[2 * i + 1]] &&
+             securite_dyn_est_pont(sd, dyn.ponts[2 * i + 1], dyn.ponts[2 * i]);
+
+    /* Composantes connexes par BFS */
+    int* comp  = (int*)malloc(n * sizeof(int));
+    int* ordre = (int*)malloc(n * sizeof(int));
+    int nb_comp = 0, nb = 0;
+    for (int i = 0; i < n; i++) comp[i] = -1;
+    for (int s = 0; s < n; s++) {
+        if (!noeud_existe(g, s) || comp[s] >= 0) continue;
+        bfs(g, s, ordre, &nb);
+        for (int i = 0; i < nb; i++) comp[ordre[i]] = nb_comp;
+        nb_comp++;
+    }
+    ok = ok && nb_comp == securite_dyn_nb_composantes(sd);
+    for (int i = 0; ok && i < n; i++) {
+        int j = (i * 7 + 3) % n;
+        ok = securite_dyn_connectes(sd, i, j) == (comp[i] == comp[j]);
+    }
+    free(comp); free(ordre); free(pont);
+    free(ref.points_articulation); free(ref.ponts);
+    free(dyn.points_articulation); free(dyn.ponts);
+    return ok;
+}
+
+void test_securite_dynamique(void) {
+    printf("\n--- Securite dynamique ---\n");
+
+    /* Deux triangles relies par le pont 2 - 3 */
+    Graphe* g = creer_graphe(6, 0);
+    for (int i = 0; i < 6; i++) ajouter_noeud(g, i, "N");
+    int tri[7][2] = {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 5}, {5, 3}};
+    for (int i = 0; i < 7; i++) ajouter_arete(g, tri[i][0], tri[i][1], 1.0f, 100.0f, 1.0f, 5);
+    SecuriteDynamique* sd = creer_securite_dynamique(g);
+    TEST("dynamique : pont 2-3, articulations 2 et 3",
+         securite_dyn_nb_ponts(sd) == 1 && securite_dyn_est_pont(sd, 3, 2) &&
+         securite_dyn_nb_articulations(sd) == 2 && securite_dyn_est_articulation(sd, 2) &&
+         !securite_dyn_est_articulation(sd, 1) && securite_dyn_nb_composantes(sd) == 1);
+    securite_dyn_ajouter_arete(sd, g, 0, 4, 1.0f, 100.0f, 1.0f, 5);
+    TEST("dynamique : ajout 0-4, plus aucun element critique",
+         securite_dyn_nb_ponts(sd) == 0 && securite_dyn_nb_articulations(sd) == 0);
+    securite_dyn_supprimer_arete(sd, g, 2, 3);
+    TEST("dynamique : arc 3->2 restant, lien 2-3 conserve", securite_dyn_nb_ponts(sd) == 0);
+    securite_dyn_supprimer_arete(sd, g, 3, 2);
+    TEST("dynamique : suppression 2-3, le lien 0-4 devient pont",
+         securite_dyn_nb_ponts(sd) == 1 && securite_dyn_est_pont(sd, 0, 4) &&
+         securite_dyn_est_articulation(sd, 0) && securite_dyn_est_articulation(sd, 4) &&
+         securite_dyn_connectes(sd, 1, 5));
+    securite_dyn_supprimer_arete(sd, g, 0, 4);
+    securite_dyn_supprimer_arete(sd, g, 4, 0);
+    TEST("dynamique : reseau coupe en deux",
+         securite_dyn_nb_composantes(sd) == 2 && !securite_dyn_connectes(sd, 1, 5) &&
+         securite_dyn_nb_ponts(sd) == 0);
+    TEST("dynamique : arc absent refuse", securite_dyn_supprimer_arete(sd, g, 0, 4) == -1);
+    detruire_securite_dynamique(sd);
+    detruire_graphe(g);
+
+    /* Suite aleatoire d'ajouts et de suppressions : comparaison au recalcul */
+    int n = 80, nb_ok = 0, nb_controles = 0;
+    g = creer_graphe(n, 0);
+    for (int i = 0; i < n; i++) ajouter_noeud(g, i, "N");
+    srand(17);
+    sd = creer_securite_dynamique(g);
+    for (int op = 0; op < 1500; op++) {
+        int u = rand_entre(0, n - 1);
+        if (rand_entre(0, 99) < 55 || !g->noeuds[u].aretes) {
+            int v = rand_entre(0, n - 1);
+            if (u != v) securite_dyn_ajouter_arete(sd, g, u, v, 1.0f, 100.0f, 1.0f, 5);
+        } else {
+            int v = g->noeuds[u].aretes->destination;
+            securite_dyn_supprimer_arete(sd, g, u, v);
+            securite_dyn_supprimer_arete(sd, g, v, u);
+        }
+        if (op % 10 == 9) {
+            nb_controles++;
+            nb_ok += meme_securite_dynamique(sd, g);
+        }
+    }
+    TEST("dynamique : 1500 mises a jour, memes ponts, articulations et composantes",
+         nb_ok == nb_controles);
+    detruire_securite_dynamique(sd);
+
+    /* Construction depuis un graphe existant */
+    sd = creer_securite_dynamique(g);
+    TEST("dynamique : creation sur graphe existant = recalcul", meme_securite_dynamique(sd, g));
+    detruire_securite_dynamique(sd);
+    detruire_graphe(g);
 }
 
 /* ============================================================
@@ -171,6 +1381,21 @@ void test_pile(void) {
     detruire_pile(p);
 }
 
+void test_tas(void) {
+    printf("\n--- Structures : Tas binaire ---\n");
+
+    TasMin* t = creer_tas(2);
+    TEST("tas vide", tas_vide(t) == 1);
+    float cles[] = {5.0f, 1.0f, 8.0f, 3.0f, 2.0f, 9.0f, 0.5f};
+    for (int i = 0; i < 7; i++) tas_inserer(t, i, cles[i]);
+    TEST("taille tas = 7", t->taille == 7);
+    float c; int ok = 1; float prec = -1.0f;
+    while (!tas_vide(t)) { tas_extraire_min(t, &c); if (c < prec) ok = 0; prec = c; }
+    TEST("extraction par cle croissante", ok);
+    TEST("extraire tas vide = -1", tas_extraire_min(t, NULL) == -1);
+    detruire_tas(t);
+}
+
 /* ============================================================
  *  MAIN DES TESTS
  * ============================================================ */
@@ -182,9 +1407,23 @@ int main(void) {
 
     test_graphe();
     test_dijkstra();
+    test_bande_passante_max();
+    test_multi_sources();
+    test_sauts_max();
+    test_backtracking();
+    test_points_passage();
+    test_etiquettes();
+    test_front_pareto();
     test_securite();
+    test_arbre_blocs();
+    test_index_accessibilite();
+    test_centralite();
+    test_voisinage();
+    test_connectivite();
+    test_securite_dynamique();
     test_file_attente();
     test_pile();
+    test_tas();
 
     printf("\n--------------------------------------\n");
     printf("RESULTAT : %d/%d tests passes\n", tests_passes, tests_total);